@@ -87,6 +87,17 @@ FSM_DEFSTATE(done_DIS)
 FSM_DEFSTATE(hunt_for_DCS_or_DTC)
 
 
+/* Hook a signal source up to one of the transmit pipelines, and let
+ * the linedriver take its samples from that pipeline.
+ */
+
+static void fax_transmit(ifax_modp source, ifax_modp pipeline)
+{
+	ifax_connect(source,pipeline);
+	ifax_connect(pipeline,fax->linedriver);
+}
+
+
 /* Jump to 'start_answer_incomming' when an incomming call is
  * accepted (answered) and we identify ourselves as a fax-machine.
  * The initialize_fsm_incomming() function is used to initialize the fsm
@@ -102,7 +113,7 @@ void fax_initialize_fsm_incomming()
 
 	fsm_init(fax->statemachines,0,start_answer_incomming,100,fax);
 
-	ifax_connect(fax->silence,fax->rateconv7k2to8k0);  /* Start silent */
+	fax_transmit(fax->silence,fax->txsamples);  /* Start silent */
 }
 
 #define NEEDS_none	/* No state-machine variables needed */
@@ -114,20 +125,19 @@ FSM_END
 
 FSM_STATE(NEEDS_none,do_CED)
 	/* Output the CED sinus signal for 3.8 sec */
-	ifax_connect(fax->sinusCED,fax->rateconv7k2to8k0);
+	fax_transmit(fax->sinusCED,fax->txsamples);
 	FSMWAITJUMP(TIMER_AUX,THREEPOINTEIGHTSECONDS,done_CED);
 FSM_END
 
 FSM_STATE(NEEDS_none,done_CED)
 	/* After the CED, wait 75ms and do the DIS */
-	ifax_connect(fax->silence,fax->rateconv7k2to8k0);
+	fax_transmit(fax->silence,fax->txsamples);
 	FSMWAITJUMP(TIMER_AUX,SEVENTYFIVEMILLISECONDS,start_DIS);
 FSM_END
 
 FSM_STATE(NEEDS_none,start_DIS)
 	/* When we hook up the HDLC+V.21 they go online and send FLAGs */
-	ifax_connect(fax->modulatorV21,fax->rateconv7k2to8k0);
-	ifax_connect(fax->encoderHDLC,fax->modulatorV21);
+	fax_transmit(fax->encoderHDLC,fax->txV21);
 
 	/* Keep sending FLAGs for one second before proceeding with frames */
 	FSMWAITJUMP(TIMER_AUX,ONESECOND,do_DIS);
@@ -158,7 +168,7 @@ FSM_END
 FSM_STATE(NEEDS_none,done_DIS)
 	/* Wait until the HDLC-frames has been transmitted before receiving */
 	if ( ifax_command(fax->encoderHDLC,CMD_HDLC_FRAMING_IDLE) > 2 ) {
-		ifax_connect(fax->silence,fax->rateconv7k2to8k0);
+		fax_transmit(fax->silence,fax->txsamples);
 		FSMJUMP(hunt_for_DCS_or_DTC);
 	}
 FSM_END
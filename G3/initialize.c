@@ -27,6 +27,7 @@
 */
 
 #include <ifax/module.h>
+#include <ifax/pipeline.h>
 #include <ifax/types.h>
 #include <ifax/misc/regmodules.h>
 #include <ifax/misc/statemachine.h>
@@ -37,7 +38,11 @@
 /* Import rate-converter filter */
 extern ifax_sint16 rate_7k2_8k_1[250];
 
-void initialize_G3fax(ifax_modp linedriver)
+/* Set up a fax context for a line, using the line's linedriver.  The new
+ * context becomes the current one ('fax') of the calling thread.
+ */
+
+struct G3fax *initialize_G3fax(ifax_modp linedriver)
 {
   fax = ifax_malloc(sizeof(*fax),"G3-fax handle");
 
@@ -49,6 +54,12 @@ void initialize_G3fax(ifax_modp linedriver)
   fax->rateconv7k2to8k0 = ifax_create_module(IFAX_RATECONVERT,10,9,250,
 					     rate_7k2_8k_1,0x10000);
 
+  /* V.21 gets a rate-converter of its own, as the stages of a compiled
+   * pipeline (see below) can't be shared.
+   */
+  fax->rateconvV21 = ifax_create_module(IFAX_RATECONVERT,10,9,250,
+					rate_7k2_8k_1,0x10000);
+
   /* Create the "binary coded signal" modulator, which is simply a
    * 300 bit/s modulator just like channel 2 of the V.21 standard.
    * The control messages are transmitted using this slower (but more
@@ -95,7 +106,29 @@ void initialize_G3fax(ifax_modp linedriver)
   fax->statemachines = fsm_allocate(1);
   fsm_setup(fax->statemachines,0,2048);
 
+  fax->linedriver = linedriver;
+
+  /* The transmit chains are static, so they are compiled into
+   * pipelines that run all the stages in one go.  One for the 7200 Hz
+   * sample sources (sinus and silence), and one for V.21 that feeds
+   * the bits from the HDLC-encoder through the modulator and the
+   * rate-converter.  The sources are hooked up to the pipelines by
+   * the state-machines.
+   */
   ifax_connect(fax->rateconv7k2to8k0,linedriver);
+  fax->txsamples = ifax_pipeline_compile(fax->rateconv7k2to8k0,
+					 fax->rateconv7k2to8k0);
+
+  ifax_connect(fax->rateconvV21,linedriver);
+  ifax_connect(fax->modulatorV21,fax->rateconvV21);
+  fax->txV21 = ifax_pipeline_compile(fax->modulatorV21,
+				     fax->rateconvV21);
+
+  /* The linedriver demands samples as soon as the line is online, so
+   * it starts out with silence until the state-machines say otherwise.
+   */
+  ifax_connect(fax->silence,fax->txsamples);
+  ifax_connect(fax->txsamples,linedriver);
 
 
   /* Test-code: run a loopback to use Andreas' fsk_demod and HDLC
@@ -109,11 +142,13 @@ void initialize_G3fax(ifax_modp linedriver)
   ifax_connect(linedriver,fax->fskd);
   ifax_connect(fax->fskd,fax->dehdlc);
   ifax_connect(fax->dehdlc,fax->faxctrl); */
+
+  return fax;
 }
 
 
 /* This function is called when there is an accepted incomming  call
- * on the global 'linedriver' that needs to be serviced.  It is
+ * on the linedriver of a fax context that needs to be serviced.  It is
  * responsible for setting up the state-machines etc.
  */
 
@@ -32,7 +32,8 @@
 #include <ifax/G3/fax.h>
 #include <ifax/misc/statemachine.h>
 
-struct G3fax *fax;
+/* The fax context of the line being serviced by this thread */
+IFAX_THREAD struct G3fax *fax;
 
 void fax_run_internals(void)
 {
@@ -40,17 +40,22 @@
 #include <stdio.h>
 #include <strings.h>
 #include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
 #include <sys/types.h>
 #include <sys/time.h>
 
 #include <ifax/ifax.h>
 #include <ifax/misc/globals.h>
+#include <ifax/misc/malloc.h>
 #include <ifax/misc/readconfig.h>
 #include <ifax/misc/environment.h>
 #include <ifax/misc/watchdog.h>
 #include <ifax/misc/regmodules.h>
 #include <ifax/misc/isdnline.h>
 #include <ifax/misc/timers.h>
+#include <ifax/misc/eventloop.h>
+#include <ifax/misc/dspthread.h>
 #include <ifax/misc/softsignals.h>
 #include <ifax/modules/linedriver.h>
 #include <ifax/G3/initialize.h>
@@ -60,8 +65,48 @@
 #include <ifax/misc/pty.h>
 #include <ifax/highlevel/commandparse.h>
 
-static struct PtyHandle *ph;
-static struct ModemHandle *mh;
+/* The lines are shared out among a number of worker threads, each
+ * running its own main loop for the lines it has been given.  Worker
+ * number 0 is the initial thread of the program.  Every worker has a
+ * DSP thread (see <ifax/misc/dspthread.h>), and hands its lines over
+ * to it while they are online.
+ */
+
+struct Worker {
+	int number;
+	pthread_t thread;
+	struct EventLoop *el;
+	struct ModemLine *lines;
+	struct ModemLine *ready, **ready_tail;	/* Lines to be serviced */
+	hard_timer_t housekeeping;
+
+	struct DSPThread *dsp;
+	struct ModemLine *online;	/* Only used by the DSP thread */
+};
+
+/* The state machines of the hardware drivers wait for some conditions
+ * by checking them every time they are run, so all lines are serviced
+ * at least this often (microseconds).
+ */
+
+#define HOUSEKEEPING_INTERVAL	500000
+
+static struct Worker *workers;
+static int num_workers;
+
+/* Sending a SIGUSR1 to the daemon prints the module statistics (when
+ * compiled in, see <ifax/module.h>) and the I/O statistics of the
+ * hardware drivers.  The signal handler only sets a
+ * flag; the printing is done from the main loop.
+ */
+
+static volatile sig_atomic_t stats_requested = 0;
+
+static void request_stats(int signum)
+{
+	stats_requested = 1;
+	signal(SIGUSR1,request_stats);
+}
 
 
 /*
@@ -121,48 +166,311 @@ static void parse_arguments(void)
 	}
 }
 
+/* A line is put on the ready queue of its worker when one of its file
+ * descriptors becomes ready, and is serviced in the next round.
+ */
+
+static void queue_line(struct Worker *w, struct ModemLine *line)
+{
+	if ( line->queued )
+		return;
+
+	line->queued = 1;
+	line->ready_next = 0;
+	*w->ready_tail = line;
+	w->ready_tail = &line->ready_next;
+}
+
+static void line_ready(void *context, int events)
+{
+	struct ModemLine *line = context;
+
+	queue_line(&workers[line->worker],line);
+}
+
+static void queue_all_lines(struct Worker *w)
+{
+	struct ModemLine *line;
+
+	for ( line=w->lines; line != 0; line = line->worker_next )
+		queue_line(w,line);
+}
+
+/* While a line is online, its hardware driver and signal chain belong
+ * to the DSP thread, which services them every tick.  When the line
+ * goes offline again, it is handed back to the worker.
+ */
+
+static void line_released(void *arg)
+{
+	struct ModemLine *line = arg;
+
+	line->dsp_owned = 0;
+	queue_line(&workers[line->worker],line);
+}
+
+static void dsp_take_line(void *arg)
+{
+	struct ModemLine *line = arg;
+	struct Worker *w = &workers[line->worker];
+
+	line->online_next = w->online;
+	w->online = line;
+}
+
+static void dsp_tick(void *arg)
+{
+	struct Worker *w = arg;
+	struct ModemLine *line, **pp;
+	struct HardwareHandle *hh;
+
+	pp = &w->online;
+
+	while ( (line = *pp) != 0 ) {
+		fax = line->fax;
+		hh = line->hh;
+
+		/* An early tick is only for the lines that asked for it,
+		 * the others are kept to the real-time schedule.
+		 */
+		if ( w->dsp->early && !hh->pending ) {
+			pp = &line->online_next;
+			continue;
+		}
+
+		hh->service_select(hh,0,0,0);
+		ifax_command(line->linedriver,CMD_LINEDRIVER_WORK);
+		if ( hh->service_readwrite != 0 )
+			hh->service_readwrite(hh);
+
+		if ( hh->state != ONLINE ) {
+			*pp = line->online_next;
+			dsp_reply(w->dsp,line_released,line);
+			continue;
+		}
+
+		if ( hh->pending )
+			w->dsp->hurry = 1;
+
+		pp = &line->online_next;
+	}
+}
+
+/* +FTH has the HDLC encoder sent on the line through the V.21
+ * modulator, and silence when done.  The signal chain is rewired in
+ * the DSP thread, so it never sees it half done.
+ */
+
+static void dsp_connect_hdlc(void *arg)
+{
+	struct ModemLine *line = arg;
+
+	ifax_connect(line->fax->encoderHDLC,line->fax->txV21);
+	ifax_connect(line->fax->txV21,line->linedriver);
+}
+
+static void dsp_connect_silence(void *arg)
+{
+	struct ModemLine *line = arg;
+
+	ifax_connect(line->fax->silence,line->fax->txsamples);
+	ifax_connect(line->fax->txsamples,line->linedriver);
+}
+
+static int line_tx_hdlc(void *arg, int on)
+{
+	struct ModemLine *line = arg;
+
+	return dsp_call(workers[line->worker].dsp,
+			on ? dsp_connect_hdlc : dsp_connect_silence,line);
+}
+
+static void service_line(struct ModemLine *line)
+{
+	fax = line->fax;
+
+	pty_service_read(line->ph);
+
+	if ( !line->dsp_owned ) {
+		line->hh->service_select(line->hh,0,0,0);
+		if ( line->hh->state == ONLINE ) {
+			line->dsp_owned = 1;
+			if ( dsp_call(workers[line->worker].dsp,
+				      dsp_take_line,line) )
+				line->dsp_owned = 0;
+		}
+		/* Flush what the driver has queued, like AT commands */
+		if ( !line->dsp_owned && line->hh->service_readwrite != 0 )
+			line->hh->service_readwrite(line->hh);
+	}
+
+	modeminput(line->mh,line->ph);
+
+	pty_service_write(line->ph);
+}
+
 /*
- * The main loop of the entire program.  All concurrent operations are
- * scheduled from here.  The inner select function takes care of waiting
- * for input/output, and all other parts of the system is designed to
- * cooperate with this inner loop.
+ * The main loop of a worker thread.  All concurrent operations on the
+ * lines of the worker are scheduled from here.  The event loop takes
+ * care of waiting for input/output and deadlines, and all other parts
+ * of the system is designed to cooperate with this inner loop.  Only
+ * the lines that have something to do are serviced, so a round takes
+ * the same time no matter how many idle lines there are.
  *
  * No part of the system can be allowed to block, as this will stall the
  * main loop, and thus possible stall some other important part of the
- * system (like the DSP chain or AT command parser).
+ * system (like the DSP chain or AT command parser), for all the lines
+ * of the worker.
  *
  * The main loop will only exit in case of an unrecoverable error.
  */
 
-static void main_loop(void)
+static void *main_loop(void *arg)
 {
-	fd_set rfd, wfd, efd;
-	int maxfd, rc;
-	struct timeval delay;
+	struct Worker *w = arg;
+	struct ModemLine *line, *ready;
 
-	ifax_dprintf(DEBUG_INFO,"Entering main loop\n");
+	ifax_dprintf(DEBUG_INFO,"Entering main loop of worker %d\n",
+		     w->number);
+
+	eventloop_current = w->el;
+	hard_timer_init(&w->housekeeping,0,HOUSEKEEPING_INTERVAL);
+	queue_all_lines(w);
 
 	for (;;) {
-		FD_ZERO(&rfd);
-		FD_ZERO(&wfd);
-		FD_ZERO(&efd);
-		maxfd = -1;
+		/* Don't wait if some lines are left with work to do.  When
+		 * a deadline has passed, it is not known whose it was, so
+		 * all lines get to look at their timers.
+		 */
+		if ( eventloop_wait(w->el,w->ready != 0 ? 0 : -1)
+		     || hard_timer_expired(&w->housekeeping) ) {
+			queue_all_lines(w);
+			hard_timer_init(&w->housekeeping,0,
+					HOUSEKEEPING_INTERVAL);
+		}
+
+		/* Lines that stopped reading on a full buffer are queued
+		 * again for the next round, as there will be no event
+		 * telling about the rest of the data.
+		 */
+		ready = w->ready;
+		w->ready = 0;
+		w->ready_tail = &w->ready;
+
+		while ( (line=ready) != 0 ) {
+			ready = line->ready_next;
+			line->queued = 0;
+			service_line(line);
+			if ( line->ph->rx_pending
+			     || (!line->dsp_owned && line->hh->pending) )
+				queue_line(w,line);
+		}
+
+		if ( w->number == 0 && stats_requested ) {
+			stats_requested = 0;
+			ifax_module_stats_dump();
+			for ( line=lines; line != 0; line = line->next )
+				if ( line->hh->stats != 0 )
+					line->hh->stats(line->hh);
+		}
+	}
+
+	return 0;
+}
+
+
+/* Set up the pty, AT-command parser and signal chain of a line.  This
+ * is done before the worker threads are started, so the module system
+ * is only modified by one thread.
+ */
+
+static void initialize_line(struct ModemLine *line)
+{
+	line->hh->initialize(line->hh);
+	if ( line->hh->error ) {
+		ifax_dprintf(DEBUG_LAST,"%s: Line %d: %s\n",progname,
+			     line->number,line->hh->errormsg);
+		exit(1);
+	}
+
+	line->ph = pty_initialize(line->pty);
+	line->mh = modem_initialize();
+
+	line->linedriver = ifax_create_module(IFAX_LINEDRIVER);
+	ifax_command(line->linedriver,CMD_LINEDRIVER_HARDWARE,line->hh);
+
+	/* ifax_command(line->linedriver,CMD_LINEDRIVER_AUDIO,
+	   ifax_create_module(IFAX_MONITOR,"/dev/dsp",1,0)); */
+	/* ifax_command(line->linedriver,CMD_LINEDRIVER_RECORD,"modem.wav"); */
 
-		hh->prepare_select(hh,&maxfd,&rfd,&wfd,&efd);
-		pty_prepare_select(ph,&maxfd,&rfd,&wfd);
+	line->fax = initialize_G3fax(line->linedriver);
+	line->mh->hdlc_tx = line->fax->encoderHDLC;
+	line->mh->tx_hdlc = line_tx_hdlc;
+	line->mh->tx_arg = line;
+}
+
+
+/* Share the lines out among the workers, each with an event loop of
+ * its own, and start the workers other than number 0.  The workers
+ * don't take the SIGUSR1 so it interrupts the wait of worker 0, which
+ * prints the statistics.
+ */
 
-		delay.tv_sec = 0;
-		delay.tv_usec = 500000;
+static void start_workers(void)
+{
+	struct ModemLine *line, **tail;
+	sigset_t sigs, oldsigs;
+	int w, priority;
+
+	num_workers = worker_threads;
+	if ( num_workers > num_lines )
+		num_workers = num_lines;
+
+	workers = ifax_malloc(sizeof(*workers)*num_workers,"Worker threads");
+
+	for ( w=0; w < num_workers; w++ ) {
+		workers[w].number = w;
+		workers[w].el = eventloop_create();
+		workers[w].ready = 0;
+		workers[w].ready_tail = &workers[w].ready;
+		tail = &workers[w].lines;
+		for ( line=lines; line != 0; line = line->next ) {
+			if ( line->number % num_workers == w ) {
+				line->worker = w;
+				pty_attach(line->ph,workers[w].el,line_ready,line);
+				line->hh->attach(line->hh,workers[w].el,
+						 line_ready,line);
+				*tail = line;
+				tail = &line->worker_next;
+			}
+		}
+		*tail = 0;
+	}
 
-		rc = select(maxfd, &rfd, &wfd, &efd, &delay);
+	sigemptyset(&sigs);
+	sigaddset(&sigs,SIGUSR1);
+	pthread_sigmask(SIG_BLOCK,&sigs,&oldsigs);
 
-		pty_service_read(ph);
-		hh->service_select(hh,&rfd, &wfd, &efd);
+	/* The sample path must never wait for the control threads */
 
-		modeminput(mh,ph);
+	priority = realtime_priority;
+	if ( priority > 0 && priority < 99 )
+		priority++;
 
-		pty_service_write(ph);
+	for ( w=0; w < num_workers; w++ )
+		workers[w].dsp = dsp_start(workers[w].el,dsp_tick,&workers[w],
+					   priority);
+
+	for ( w=1; w < num_workers; w++ ) {
+		if ( pthread_create(&workers[w].thread,0,main_loop,
+				    &workers[w]) != 0 ) {
+			ifax_dprintf(DEBUG_LAST,"Unable to start worker %d\n",
+				     w);
+			exit(1);
+		}
 	}
+
+	pthread_sigmask(SIG_SETMASK,&oldsigs,0);
 }
 
 
@@ -170,13 +478,15 @@ static void main_loop(void)
 
 void main(int ac, char **av)
 {
+	struct ModemLine *line;
+
 	argc = ac;
 	argv = av;
 
 	parse_arguments();
 	read_configuration_file();
 
-	if ( hh == 0 ) {
+	if ( num_lines == 0 ) {
 		ifax_dprintf(DEBUG_LAST,"No hardware device configured\n");
 		exit(1);
 	}
@@ -190,26 +500,23 @@ void main(int ac, char **av)
 	}
 
 	register_modules();
+	signal(SIGUSR1,request_stats);
 
 	/* Start slave I/O and interface process here when available... */
 
-	ph = pty_initialize("/dev/ptyp9");
-	mh = modem_initialize();
-
-	linedriver = ifax_create_module(IFAX_LINEDRIVER);
-	ifax_command(linedriver,CMD_LINEDRIVER_HARDWARE,hh);
-
-	/* ifax_command(linedriver,CMD_LINEDRIVER_AUDIO); */
-	/* ifax_command(linedriver,CMD_LINEDRIVER_RECORD,"modem.dat"); */
+	for ( line=lines; line != 0; line = line->next )
+		initialize_line(line);
 
-	initialize_G3fax(linedriver);
+	/* The worker threads inherit the real-time scheduling */
 
 	initialize_realtime();
 
-	main_loop();
+	start_workers();
+	main_loop(&workers[0]);
 
 	/* Should never get here */
-	ifax_command(linedriver,CMD_LINEDRIVER_RECORD,(char *)0);
+	for ( line=lines; line != 0; line = line->next )
+		ifax_command(line->linedriver,CMD_LINEDRIVER_RECORD,(char *)0);
 	check_stack_usage();
 
 	exit(0);
@@ -32,7 +32,9 @@
 #include <stdlib.h>
 #include <ctype.h>
 
+#include <ifax/ifax.h>
 #include <ifax/misc/malloc.h>
+#include <ifax/modules/hdlc-framing.h>
 #include <ifax/highlevel/commandparse.h>
 #include <ifax/misc/pty.h>
 
@@ -92,10 +94,19 @@ void at_bad_error(struct ModemHandle *mh, struct PtyHandle *ph)
 struct ModemHandle *modem_initialize(void)
 {
 	struct ModemHandle *mh;
+	int t;
 
 	if ( (mh = ifax_malloc(sizeof(*mh),"ModemHandle instance")) == 0 )
 		return 0;
 
+	mh->hdlc_tx = 0;
+	mh->tx_hdlc = 0;
+	mh->tx_arg = 0;
+	for ( t=0; t < MODEMHANDLE_FRAMES; t++ )
+		mh->frame_busy[t] = 0;
+	mh->frame_current = -1;
+	mh->fth_preamble = 0;
+
 	at_parse_reset(mh);
 	setup_default(&mh->mstat_current);
 	calculate_stuff(mh);
@@ -342,55 +353,162 @@ int do_frh(struct ModemHandle *mh, struct PtyHandle *ph,
 }
 
 
-/* FIXME: Needs to have a separate filler function */
+/* AT+FTH sends HDLC-frames, fax class 1.  The frames are handed to the
+ * HDLC encoder as they are completed, so the application may go on with
+ * the next frame while the previous ones are being sent.  The frames are
+ * kept in the ModemHandle until the encoder is done with them, and the
+ * application is held back when they are all in flight.
+ *
+ * The first frame is preceded by one second of flags, counted as idle
+ * bits sent by the encoder; the application's data waits in the pty
+ * until then.  After the final frame, the line is held until a flag
+ * more than the closing one has been sent.
+ */
 
-int do_fth(struct ModemHandle *mh, struct PtyHandle *ph,
-	   char *prebuf, char **postbuf, mdmcmd *cmd)
+#define FTH_PREAMBLE_BITS	300	/* One second at 300 bit/s */
+#define FTH_TRAILER_BITS	8
+
+static void fth_frame_done(void *arg, ifax_uint8 *start)
 {
-#if 0
-	/* FIXME: Needs to do this properly */
-	int have_dle;
-	char buf;
-	char bigbuffer[1024];
-	int bufferpos;
+	*(int *)arg = 0;
+}
 
-	int rc;
+static int fth_find_frame(struct ModemHandle *mh)
+{
+	int t;
+
+	if ( mh->hdlc_tx != 0 )
+		ifax_command(mh->hdlc_tx,CMD_HDLC_FRAMING_COMPLETE);
+
+	for ( t=0; t < MODEMHANDLE_FRAMES; t++ ) {
+		if ( !mh->frame_busy[t] ) {
+			mh->frame_current = t;
+			mh->auxpos = 0;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/* After the final frame, OK is given when it has been sent, closing
+ * flag and all, and the line is back to silence.
+ */
+
+static int parse_fth_final(struct ModemHandle *mh, struct PtyHandle *ph)
+{
+	if ( mh->hdlc_tx != 0 && ifax_command(mh->hdlc_tx,CMD_HDLC_FRAMING_IDLE)
+	     <= FTH_TRAILER_BITS )
+		return 0;
+
+	if ( mh->tx_hdlc != 0 && (*mh->tx_hdlc)(mh->tx_arg,0) )
+		return 0;
+
+	pty_printf(ph,"OK%s",mh->crlf);
+	at_parse_reset(mh);
+	return 1;
+}
+
+static int fth_frame_end(struct ModemHandle *mh, struct PtyHandle *ph)
+{
+	ifax_uint8 *frame = mh->frame[mh->frame_current];
+	int *busy = &mh->frame_busy[mh->frame_current];
+
+	mh->frame_current = -1;
+
+	/* Address and control field at least */
+	if ( mh->auxpos < 2 ) {
+		at_bad_error(mh,ph);
+		return 1;
+	}
+
+	if ( mh->hdlc_tx != 0 ) {
+		*busy = 1;
+		if ( ifax_command(mh->hdlc_tx,CMD_HDLC_FRAMING_SUBMIT,
+				  &frame[1],mh->auxpos-1,frame[0],
+				  fth_frame_done,busy) )
+			*busy = 0;
+	}
+
+	/* The final frame has the P/F bit set in the control field */
+	if ( frame[1] & 0x10 ) {
+		mh->function = parse_fth_final;
+		return 1;
+	}
+
+	pty_printf(ph,"CONNECT%s",mh->crlf);
+	return 1;
+}
 
-	rc = do_fspecial(mh,ph,prebuf,postbuf,cmd,"3,72,96");
-	if ( rc < 0 ) {
-		have_dle=0;
-		printf("Receiving HDLC:");
-		do {
-			printf("\nCONNECT\n");
-			pty_write(ph,"CONNECT\n",8);
-			bufferpos=0;
-			while(1) {
-				read(io,&buf,1);
-				if (have_dle) {
-					if (buf==DLE) {
-						bigbuffer[bufferpos++]=0x10;
-						printf("DLE ");
-					}
-					if (buf==ETX) {
-						printf("ETX ");
-						break;
-					}
-					have_dle=0;
-				} else if (buf==DLE) {
-					have_dle=1;
-				} else {
-					bigbuffer[bufferpos++]=buf;
-					printf("%02x  ",buf);
+static int parse_fth_data(struct ModemHandle *mh, struct PtyHandle *ph)
+{
+	ifax_uint8 c, *walk;
+	size_t size, used;
+
+	if ( mh->fth_preamble > 0 ) {
+		if ( ifax_command(mh->hdlc_tx,CMD_HDLC_FRAMING_IDLE)
+		     < mh->fth_preamble )
+			return 0;
+		mh->fth_preamble = 0;
+	}
+
+	if ( mh->frame_current < 0 && !fth_find_frame(mh) )
+		return 0;
+
+	for (;;) {
+		pty_readbuffer(ph,&walk,&size);
+
+		if ( size == 0 )
+			return 0;
+
+		used = 0;
+		while ( size > 0 ) {
+
+			c = *walk++;
+			used++;
+			size--;
+			
+			if ( mh->have_dle ) {
+				mh->have_dle = 0;
+				if ( c == ETX ) {
+					pty_advance(ph,used);
+					return fth_frame_end(mh,ph);
 				}
+			} else if ( c == DLE ) {
+				mh->have_dle = 1;
+				continue;
 			}
-			if (bigbuffer[1]==0x03) printf("\n more frames follow !");
-			else break;
-		} while(1);
-		rc=0;
+
+			if ( mh->auxpos < MODEMHANDLE_FRAMESIZE )
+				mh->frame[mh->frame_current][mh->auxpos++] = c;
+		}
+
+		pty_advance(ph,used);
 	}
+}
 
-	return rc;
-#endif
+int do_fth(struct ModemHandle *mh, struct PtyHandle *ph,
+	   char *prebuf, char **postbuf, mdmcmd *cmd)
+{
+	if ( !do_special(mh,ph,prebuf,postbuf,cmd,"3") )
+		return 0;
+
+	if ( mh->tx_hdlc != 0 && (*mh->tx_hdlc)(mh->tx_arg,1) ) {
+		at_bad_error(mh,ph);
+		return 0;
+	}
+
+	/* The encoder counts idle bits on from where it stopped last */
+	mh->fth_preamble = 0;
+	if ( mh->hdlc_tx != 0 )
+		mh->fth_preamble = ifax_command(mh->hdlc_tx,
+						CMD_HDLC_FRAMING_IDLE)
+			+ FTH_PREAMBLE_BITS;
+
+	mh->function = parse_fth_data;
+	mh->frame_current = -1;
+	mh->have_dle = 0;
+	pty_printf(ph,"CONNECT%s",mh->crlf);
 
 	return 0;
 }
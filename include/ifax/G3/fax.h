@@ -35,6 +35,7 @@
 struct G3fax {
 	ifax_modp linedriver;
 	ifax_modp rateconv7k2to8k0;
+	ifax_modp rateconvV21;
 	ifax_modp sinusCED;
 	ifax_modp sinusCNG;
 	ifax_modp silence;
@@ -43,6 +44,10 @@ struct G3fax {
 	ifax_modp modulatorV29;
 	ifax_modp encoderHDLC;
 
+	/* Compiled transmit pipelines, both ending in the linedriver */
+	ifax_modp txsamples;	/* Rate-converter for 7200 Hz samples */
+	ifax_modp txV21;	/* V.21 modulator and rate-converter */
+
 	ifax_modp fskd, dehdlc, faxctrl;
 
 	struct StateMachinesHandle *statemachines;
@@ -51,7 +56,7 @@ struct G3fax {
 	int DISsize, CSIsize, NSFsize;
 };
 
-extern struct G3fax *fax;
+extern IFAX_THREAD struct G3fax *fax;
 
 /* Control octet; 1st octet of frame */
 #define FAX_CNTL_NONLAST_FRAME       0xC0
@@ -30,3 +30,7 @@
 
 extern ifax_uint8 sint2wala[4096];
 extern ifax_sint16 wala2sint[256];
+extern ifax_sint16 sint2qsint[4096];
+
+void sint2wala_block(ifax_sint16 *src, ifax_uint8 *dst, int cnt);
+void wala2sint_block(ifax_uint8 *src, ifax_sint16 *dst, int cnt);
@@ -25,4 +25,12 @@
    ******************************************************************************
  */
 
+/* Angle of the vector (x,y), where a full circle is 0x10000 */
 extern unsigned short intatan (short y, short x);
+
+/* Length of the vector (x,y), sqrt(x*x + y*y) */
+extern unsigned short intmag (short y, short x);
+
+/* Angles of 'n' vectors, and their lengths unless 'mag' is NULL */
+extern void intatan_block (const short *y, const short *x,
+			   unsigned short *angle, unsigned short *mag, int n);
@@ -0,0 +1,69 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   CRC-16/CCITT frame check sequence of HDLC frames.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+#ifndef _IFAX_CRC16_H
+#define _IFAX_CRC16_H
+
+#include <stddef.h>
+#include <ifax/types.h>
+
+/* The HDLC frame check sequence (ITU-T V.42, ISO 3309) is the
+ * CRC-16/CCITT of the frame in transmission order, that is with the
+ * least significant bit of each byte first.  The register starts out
+ * as IFAX_CRC16_INIT, and is complemented and sent low byte first after
+ * the frame.  Running the register over a frame and its FCS leaves
+ * IFAX_CRC16_GOOD in it if the frame is intact.
+ */
+
+#define IFAX_CRC16_INIT		0xFFFF
+#define IFAX_CRC16_GOOD		0xF0B8
+
+/* Run the register 'crc' over 'length' bytes, and return it */
+ifax_uint16 ifax_crc16_update(ifax_uint16 crc, const ifax_uint8 *data,
+			      size_t length);
+
+/* FCS of a whole frame, to be sent low byte first */
+ifax_uint16 ifax_crc16(const ifax_uint8 *data, size_t length);
+
+/* Nonzero if a frame ending with its FCS is intact */
+int ifax_crc16_check(const ifax_uint8 *data, size_t length);
+
+/* The ways of updating the register that ifax_crc16_update chooses
+ * between.  The carry-less multiply version uses the PCLMULQDQ
+ * instruction, and falls back on slicing-by-8 where it is not
+ * available.  These are for testing and benchmarks.
+ */
+ifax_uint16 ifax_crc16_bytewise(ifax_uint16 crc, const ifax_uint8 *data,
+				size_t length);
+ifax_uint16 ifax_crc16_slice8(ifax_uint16 crc, const ifax_uint8 *data,
+			      size_t length);
+ifax_uint16 ifax_crc16_clmul(ifax_uint16 crc, const ifax_uint8 *data,
+			     size_t length);
+
+/* Name of the version ifax_crc16_update uses on this machine */
+const char *ifax_crc16_engine(void);
+
+#endif
@@ -31,6 +31,8 @@
 #include <ifax/misc/pty.h>
 
 #define MODEMHANDLE_TMPBUFFER_SIZE	2048
+#define MODEMHANDLE_FRAMES		32	/* +FTH frames in flight */
+#define MODEMHANDLE_FRAMESIZE		288
 
 #define DLE	0x10
 #define ETX	0x03
@@ -94,6 +96,20 @@ struct ModemHandle {
 	int auxpos;		/* Current end of frame pointer */
 	int have_dle;		/* Nonzer of last byte was DLE */
 
+	/* HDLC-frames given by +FTH are sent from here by 'hdlc_tx'.  A
+	 * frame is busy until the encoder is done with it.  'tx_hdlc' is
+	 * called with 'on' nonzero to have the encoder sent on the line,
+	 * and with zero to go back to silence; it returns nonzero if the
+	 * line could not be switched (yet).
+	 */
+	struct ifax_module *hdlc_tx;
+	int (*tx_hdlc)(void *tx_arg, int on);
+	void *tx_arg;
+	ifax_uint8 frame[MODEMHANDLE_FRAMES][MODEMHANDLE_FRAMESIZE];
+	int frame_busy[MODEMHANDLE_FRAMES];
+	int frame_current;	/* Frame being filled, or -1 */
+	int fth_preamble;	/* Idle bits to be sent before the first */
+
 	/* Function to call to handle input to the modem */
 	int (*function)(struct ModemHandle *, struct PtyHandle *);
 
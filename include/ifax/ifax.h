@@ -17,6 +17,7 @@
 #include <ifax/types.h>
 #include <ifax/debug.h>
 #include <ifax/module.h>
+#include <ifax/pipeline.h>
 #include <ifax/bitreverse.h>
 #include <ifax/sincos.h>
 #include <ifax/int2alaw.h>
@@ -24,6 +25,7 @@
 #include <ifax/g711.h>
 #include <ifax/atan.h>
 #include <ifax/sqrt.h>
+#include <ifax/crc16.h>
 
 
 
@@ -0,0 +1,91 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Real-time thread for the signal processing.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+#ifndef _MISC_DSPTHREAD_H
+#define _MISC_DSPTHREAD_H
+
+#include <pthread.h>
+
+#include <ifax/misc/eventloop.h>
+#include <ifax/misc/iobuffer.h>
+
+/* The signal processing of the lines runs in a thread of its own, at a
+ * higher real-time priority than the thread running the AT-commands,
+ * pty and state machines (the control thread).  It wakes up every tick
+ * to move samples to and from the hardware and through the modules.
+ *
+ * The two threads don't share any data directly.  The control thread
+ * asks the DSP thread to do things (like connect a modulator to the
+ * linedriver) by sending it a function to call, and the DSP thread
+ * sends functions back the same way.  Each direction has a lock-free
+ * ring (IORing) of calls, so neither thread ever waits for the other.
+ */
+
+/* Milliseconds between each round of signal processing */
+#define DSP_TICK	16
+
+typedef void (*dsp_function)(void *arg);
+
+struct DSPThread {
+	pthread_t thread;
+	struct EventLoop *el;			/* Of the DSP thread */
+	struct EventSource wakeup;		/* Calls are waiting */
+	struct EventSource notify;		/* Calls waiting for control */
+	struct IORing *calls;			/* Control -> DSP */
+	struct IORing *replies;			/* DSP -> control */
+	struct timeval next_tick;
+
+	/* Called every tick, in the DSP thread */
+	dsp_function tick;
+	void *tick_arg;
+
+	/* Set by 'tick' to have the next tick at once, like when
+	 * replaying a file as fast as possible.  Such an early tick has
+	 * 'early' set, and should only do what asked for it; the regular
+	 * ticks are kept on schedule in between.
+	 */
+	int hurry;
+	int early;
+};
+
+/* Start a DSP thread; the calls it sends back are run by the control
+ * thread owning 'control' (when it is waiting in eventloop_wait).
+ */
+extern struct DSPThread *dsp_start(struct EventLoop *control,
+				   dsp_function tick, void *tick_arg,
+				   int priority);
+
+/* Have 'function' called in the DSP thread.  Returns nonzero if there
+ * was no room for the call.  Only the control thread may use this.
+ */
+extern int dsp_call(struct DSPThread *dsp, dsp_function function, void *arg);
+
+/* Have 'function' called in the control thread.  Returns nonzero if
+ * there was no room for the call.  Only the DSP thread may use this.
+ */
+extern int dsp_reply(struct DSPThread *dsp, dsp_function function, void *arg);
+
+#endif
@@ -0,0 +1,73 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Event loop waiting for file descriptors and deadlines.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+#ifndef _MISC_EVENTLOOP_H
+#define _MISC_EVENTLOOP_H
+
+#include <sys/time.h>
+
+#include <ifax/types.h>
+
+/* A file descriptor is registered with the event loop once, and its
+ * handler is called every time it *becomes* readable or writable (edge
+ * triggered).  The owner must therefore keep reading or writing until
+ * the operation would block before it can expect to hear from the
+ * event loop again.
+ */
+
+#define EVENT_READ	1
+#define EVENT_WRITE	2
+#define EVENT_ERROR	4
+
+typedef void (*event_handler)(void *context, int events);
+
+struct EventSource {
+	int fd;
+	event_handler handler;
+	void *context;
+};
+
+struct EventLoop;
+
+/* The event loop used by the current thread, for deadlines */
+extern IFAX_THREAD struct EventLoop *eventloop_current;
+
+extern struct EventLoop *eventloop_create(void);
+extern void eventloop_add(struct EventLoop *el, struct EventSource *src);
+extern void eventloop_remove(struct EventLoop *el, struct EventSource *src);
+
+/* Make sure the event loop wakes up no later than 'when' (absolute
+ * time, as from gettimeofday).  Only the earliest deadline is kept.
+ */
+extern void eventloop_deadline(struct EventLoop *el, struct timeval *when);
+
+/* Wait for up to 'timeout' milliseconds (-1 is forever, 0 is not at
+ * all), and call the handlers of the sources that are ready.  Returns
+ * nonzero if it timed out or a deadline expired.
+ */
+extern int eventloop_wait(struct EventLoop *el, int timeout);
+
+#endif
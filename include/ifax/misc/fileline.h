@@ -0,0 +1,59 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Hardware driver replaying recorded calls from files
+  
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+#ifndef _MISC_FILELINE_H
+#define _MISC_FILELINE_H
+
+#include <stdio.h>
+#include <sys/time.h>
+
+#include <ifax/misc/hardware-driver.h>
+
+#define FILENAME_SIZE	     256
+#define FILEREAD_SIZE	    4096
+
+/* Samples given to the signal chain each time the driver is serviced
+ * (one second).  The driver asks to be serviced again right away as
+ * long as there is more input.
+ */
+#define FILE_SAMPLES_PER_SERVICE	8000
+
+struct FileHandle {
+	FILE *in, *out;
+	char input[FILENAME_SIZE];		/* Recorded call to replay */
+	char output[FILENAME_SIZE];		/* Where to put transmission */
+	int budget;				/* Samples left this time */
+	int have_dle;				/* Last byte read was DLE */
+	int rp, size;				/* Read buffer position */
+	long samples;				/* Samples replayed in total */
+	struct timeval start;			/* When replay started */
+	ifax_uint8 rbuf[FILEREAD_SIZE];
+	ifax_uint8 wbuf[2*FILEREAD_SIZE];	/* Room for DLE doubling */
+};
+
+void file_allocate(struct HardwareHandle *hh);
+
+#endif
@@ -26,9 +26,37 @@
 ******************************************************************************
 */
 
+#ifndef _IFAX_MISC_GLOBALS_H
+#define _IFAX_MISC_GLOBALS_H
+
 #include <ifax/module.h>
 
+/* Each phone line served by the daemon has its own hardware driver,
+ * pty, AT-command parser and signal chain.  The lines are set up by
+ * the configuration file, and the rest is filled in by 'amodemd'.
+ */
+
+struct ModemLine {
+	int number;			/* 0, 1, ... in config file order */
+	struct HardwareHandle *hh;	/* Phone line */
+	char *pty;			/* Name of the pty device */
+	struct PtyHandle *ph;
+	struct ModemHandle *mh;
+	ifax_modp linedriver;
+	struct G3fax *fax;
+	struct ModemLine *next;		/* Next line in config file */
+
+	int worker;			/* Worker thread serving the line */
+	struct ModemLine *worker_next;	/* Next line of same worker thread */
+	int queued;			/* Nonzero if on the ready queue */
+	struct ModemLine *ready_next;	/* Next line on the ready queue */
+	int dsp_owned;			/* Nonzero while in the DSP thread */
+	struct ModemLine *online_next;	/* Next line of same DSP thread */
+};
+
 extern char *progname;        /* Name of executable/program */
 extern int run_as_daemon;     /* nonzero if running as daemon */
-extern ifax_modp linedriver;		/* Common linedriver */
-extern struct HardwareHandle *hh;	/* Phone line */
+extern struct ModemLine *lines;		/* All phone lines */
+extern int num_lines;
+
+#endif
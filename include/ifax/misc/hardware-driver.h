@@ -33,6 +33,7 @@
 #include <unistd.h>
 
 #include <ifax/types.h>
+#include <ifax/misc/eventloop.h>
 
 typedef enum {
 	UNKNOWN=0,		/* Unknown, uninitialized status */
@@ -47,7 +48,9 @@ typedef enum {
 } hardware_state_t;
 
 typedef enum {
-	ISDN		/* Use /dev/ttyI* devices for ISDN line access */
+	ISDN,		/* Use /dev/ttyI* devices for ISDN line access */
+	AUDIOFILE,	/* Replay a recorded call from a file */
+	LOOPBACK	/* Connected to another line of the daemon */
 } hardware_type_t;
 
 struct HardwareHandle {
@@ -64,6 +67,12 @@ struct HardwareHandle {
 	int error;
 	char errormsg[128];
 
+	/* Set by 'service_select' when the driver stopped before it had
+	 * read everything available, and wants to be serviced again
+	 * without waiting for the event loop to report anything.
+	 */
+	int pending;
+
 	/* Set up all three fd_set used in a select for the hardware
 	 * driver.  The 'maxfd' is increased to the max fd-value used by
 	 * the hardware driver (if it is smaller initially).
@@ -78,6 +87,15 @@ struct HardwareHandle {
 	void (*service_select)(struct HardwareHandle *hh,
 			       fd_set *r, fd_set *w, fd_set *e);
 
+	/* Instead of the two functions above, the file descriptors of the
+	 * driver can be registered with an event loop.  The 'handler' is
+	 * called with 'context' when one of them becomes ready, and then
+	 * 'service_select' should be called with no fd_sets.  Descriptors
+	 * opened later by the driver are registered as well.
+	 */
+	void (*attach)(struct HardwareHandle *hh, struct EventLoop *el,
+		       event_handler handler, void *context);
+
 	/* This service function must be called after all the read and
 	 * write operations on the hardware has been performed.  This is
 	 * used to clean up, flush buffers etc. (or nothing at all).
@@ -96,9 +114,10 @@ struct HardwareHandle {
 	 */
 	void (*hangup)(struct HardwareHandle *hh);
 
-	/* Read a number of samples from the hardware driver.
+	/* Read a number of (16-bit signed) samples from the hardware
+	 * driver.  Returns the number of samples read, or -1 on error.
 	 */
-	void (*read)(struct HardwareHandle *hh, ifax_uint8 *smpls, int cnt);
+	int (*read)(struct HardwareHandle *hh, ifax_sint16 *smpls, int cnt);
 
 	/* Write a number of (16-bit signed) samples to the hardware driver.
 	 */
@@ -112,6 +131,11 @@ struct HardwareHandle {
 	 * it can be used properly (used in select loops).
 	 */
 	void (*initialize)(struct HardwareHandle *hh);
+
+	/* Log statistics of the I/O done by the driver since the last
+	 * time, or NULL if the driver keeps none.
+	 */
+	void (*stats)(struct HardwareHandle *hh);
 };
 
 struct HardwareHandle *hardware_allocate(char *hardware);
@@ -29,14 +29,32 @@
 #ifndef _MISC_IOBUFFER_H
 #define _MISC_IOBUFFER_H
 
+#include <sys/time.h>
 #include <ifax/types.h>
 #include <ifax/misc/malloc.h>
 
+/* Counters of the system calls done on a buffer, since 'since' */
+struct IOStats {
+	unsigned long reads, read_bytes;
+	unsigned long writes, write_bytes;
+	struct timeval since;
+};
+
 struct IOBuffer {
 	ifax_uint32 fp, dp, size, total;
 	ifax_uint8 *data;
+	int mirrored;			/* Data mapped twice in a row */
 	int debug_buffer_idx;
 
+	/* Write batching, see 'iobuffer_write_batched' */
+	int batch_defer;		/* Most calls to hold data back */
+	int batch_waited;		/* Calls data has been held back */
+	long batch_rate;		/* Bytes filled per call, times 16 */
+	ifax_uint32 filled, batch_mark;	/* Bytes filled, at last call */
+
+	struct IOStats stats;
+	struct IOStats reported;	/* As of the last dump */
+
 	enum {
 		FILLUPDATE = 1,
 		WRITE = 2
@@ -46,6 +64,7 @@ struct IOBuffer {
 };
 
 struct IOBuffer *iobuffer_allocate(int size, char *devinfo);
+struct IOBuffer *iobuffer_allocate_mirrored(int size, char *devinfo);
 void iobuffer_fill_segment(struct IOBuffer *iob, ifax_uint8 **dst, int *len);
 void iobuffer_fill_update(struct IOBuffer *iob, int size, char *info);
 void iobuffer_fill(struct IOBuffer *iob, ifax_uint8 *src, int size);
@@ -56,6 +75,25 @@ void iobuffer_drain_update(struct IOBuffer *iob, int size);
 int iobuffer_drain(struct IOBuffer *iob, ifax_uint8 *dst, int size);
 int iobuffer_read(struct IOBuffer *iob, int fd);
 int iobuffer_write(struct IOBuffer *iob, int fd);
+void iobuffer_batch(struct IOBuffer *iob, int defer);
+int iobuffer_write_batched(struct IOBuffer *iob, int fd);
+void iobuffer_stats_dump(struct IOBuffer *iob);
 void iobuffer_reset(struct IOBuffer *iob);
 
+/* Ring buffer for passing data between exactly two threads, one that
+ * fills it and one that drains it, without any locking.
+ */
+struct IORing {
+	volatile ifax_uint32 fp, dp;	/* Bytes filled/drained in total */
+	ifax_uint32 mask;		/* Size of ring minus one */
+	ifax_uint8 *data;
+	char descr[32];
+};
+
+struct IORing *ioring_allocate(int size, char *devinfo);
+int ioring_used(struct IORing *ior);
+int ioring_room(struct IORing *ior);
+int ioring_fill(struct IORing *ior, void *src, int size);
+int ioring_drain(struct IORing *ior, void *dst, int size);
+
 #endif
@@ -71,6 +71,7 @@ struct IsdnHandle {
 	struct IOBuffer *incomming_buffer;
 	struct IOBuffer *outgoing_buffer;
 	int at_idx;				/* Current char of at_cmd */
+	int plain;				/* Bytes starting no message */
 	unsigned int messages;			/* Accumulated messages */
 	/* int at_cmd_ok;	*/		/* nonzero => AT command ok */
 	time_t start_time, end_time;		/* Call timing info */
@@ -78,6 +79,9 @@ struct IsdnHandle {
 	int request_hangup;			/* Force hangup of call */
 	int request_answer;			/* Accept incomming call */
 	int indication_ringing;			/* Inncomming call detected */
+	int last_state;				/* Last state logged */
+	struct EventLoop *el;			/* Attached to, or NULL */
+	struct EventSource source;
 	char device[ISDNDEVNME_SIZE];		/* Name of ISDN-device */
 	char ourmsn[ISDNMSN_SIZE];		/* Our MSN */
 	char dialmsn[ISDNMSN_SIZE];		/* Diel this number */
@@ -89,3 +93,14 @@ struct IsdnHandle {
 };
 
 void isdn_allocate(struct HardwareHandle *hh);
+
+int count_dle(ifax_uint8 *p, int len);
+int find_dle(ifax_uint8 *p, int len);
+void stuff_dle(ifax_uint8 *buf, int len, int dles);
+int isdn_encode_samples(ifax_sint16 *src, ifax_uint8 *dst, int cnt);
+
+/* The ISDN messages (OK, RING, ...) in a block of input, see isdnline.c.
+ * The automaton is made by the first isdn_allocate.
+ */
+int matcher_scan(ifax_uint8 *buf, int len);
+int matcher_anchored(ifax_uint8 *buf, int len, int *partial);
@@ -0,0 +1,61 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Hardware driver connecting two lines of the daemon to each other
+  
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+#ifndef _MISC_LOOPLINE_H
+#define _MISC_LOOPLINE_H
+
+#include <sys/time.h>
+
+#include <ifax/misc/iobuffer.h>
+#include <ifax/misc/hardware-driver.h>
+
+#define LOOPBACK_NAME_SIZE	32
+
+/* Delay in samples from one end to the other (20 ms) */
+#define LOOPBACK_DEFAULT_DELAY	160
+
+struct LoopbackPair {
+	char name[LOOPBACK_NAME_SIZE];
+	struct LoopbackHandle *end[2];
+	volatile int hungup;		/* Set when either end hangs up */
+	struct LoopbackPair *next;
+};
+
+struct LoopbackHandle {
+	struct HardwareHandle *hh;
+	struct LoopbackPair *pair;
+	int side;			/* Index in pair->end[] */
+	char name[LOOPBACK_NAME_SIZE];	/* Pair to join */
+	int delay;			/* Samples from one end to the other */
+	long length;			/* Samples before hangup, 0 for never */
+	struct IORing *rx, *tx;		/* Samples from/to the other end */
+	long samples;			/* Samples received in total */
+	struct timeval start;		/* When the call was connected */
+};
+
+void loopback_allocate(struct HardwareHandle *hh);
+
+#endif
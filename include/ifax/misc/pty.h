@@ -31,6 +31,8 @@
 #include <sys/timeb.h>
 
 #include <ifax/types.h>
+#include <ifax/misc/eventloop.h>
+#include <ifax/misc/iobuffer.h>
 
 #ifndef _MISC_PTY_H
 #define _MISC_PTY_H
@@ -48,16 +50,19 @@ struct PtyHandle {
 		LOG_WRITE=4
 	} debug;
 
-	struct PtyBuffer {
-		int wp, rp, size;
-		ifax_uint8 buffer[PTY_BUFFERSIZE];
-	} tx, rx;
+	struct IOBuffer *tx, *rx;	/* Mirrored, see <ifax/misc/iobuffer.h> */
 
 	char device[PTY_DEVNAME_SIZE+2];
+
+	struct EventLoop *el;		/* Event loop, if attached to one */
+	struct EventSource source;
+	int rx_pending;			/* Read stopped by a full buffer */
 };
 
 extern struct PtyHandle *pty_initialize(char *device);
 extern void pty_reset(struct PtyHandle *ph);
+extern void pty_attach(struct PtyHandle *ph, struct EventLoop *el,
+		       event_handler handler, void *context);
 extern int pty_write_max(struct PtyHandle *ph);    /* How large write is OK */
 extern int pty_write_queued(struct PtyHandle *ph); /* Size of current queue */
 extern int pty_read_max(struct PtyHandle *ph);      /* How large read is OK */extern void pty_write(struct PtyHandle *ph, void *buf, size_t size);
@@ -36,5 +36,6 @@ extern char *int_prefix;
 extern int watchdog_timeout;
 extern int realtime_priority;
 extern int do_lock_memory;
+extern int worker_threads;
 
 extern void read_configuration_file(void);
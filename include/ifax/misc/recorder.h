@@ -0,0 +1,84 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Recording of calls to file from a background thread.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+#ifndef _MISC_RECORDER_H
+#define _MISC_RECORDER_H
+
+#include <pthread.h>
+
+#include <ifax/types.h>
+#include <ifax/misc/iobuffer.h>
+
+/* A recorder writes 16-bit samples to a WAV file without ever making the
+ * thread producing them wait for the disk.  The samples are put in a
+ * ring of bounded size, and a thread of its own (at normal priority)
+ * takes them out and writes them to the file.  When the ring is full,
+ * the samples are dropped and counted instead.
+ *
+ * The same can be done for any file descriptor already open, like a
+ * socket or sound card, in which case the samples are written as they
+ * are with no header.  If a write fails, the rest of the samples are
+ * thrown away by the thread.
+ */
+
+/* Bytes of samples the ring can hold */
+#define RECORDER_RING	65536
+
+struct Recorder {
+	pthread_t thread;
+	struct IORing *ring;
+	int fd;
+	int channels, rate;
+	volatile int stop;		/* Set to have the thread finish */
+	int wav;			/* Header to be finished at stop */
+	int failed;			/* Writes given up after an error */
+	unsigned long dropped;		/* Frames dropped on a full ring */
+	unsigned long written;		/* Frames written to the file */
+	char name[64];
+};
+
+/* Create the file 'name' and start recording to it.  Returns NULL if
+ * the file can't be made or the thread started.
+ */
+struct Recorder *recorder_start(char *name, int channels, int rate);
+
+/* Start writing raw samples to 'fd', which is closed when the recorder
+ * stops (or fails to start).  The name is only used in messages.
+ */
+struct Recorder *recorder_attach(int fd, char *name, int channels, int rate);
+
+/* Queue 'frames' frames of interleaved samples.  Never blocks; returns
+ * nonzero if they were dropped.
+ */
+int recorder_write(struct Recorder *rec, ifax_sint16 *samples, int frames);
+
+/* Write out what is queued, finish the file (if WAV) and free the recorder.
+ * Waits for the thread to finish, so it must not be called from a
+ * real-time thread.
+ */
+void recorder_stop(struct Recorder *rec);
+
+#endif
@@ -54,5 +54,10 @@ extern ifax_module_id IFAX_LINEDRIVER;
 extern ifax_module_id IFAX_SIGNALGEN;
 extern ifax_module_id IFAX_V29DEMOD;
 extern ifax_module_id IFAX_ENCODER_HDLC;
+extern ifax_module_id IFAX_FSKDEMOD_BANK;
+extern ifax_module_id IFAX_MODULATORV21_BANK;
+extern ifax_module_id IFAX_RATECONVERT_BANK;
+extern ifax_module_id IFAX_CHANNEL;
+extern ifax_module_id IFAX_MONITOR;
 
 extern void register_modules(void);
@@ -32,12 +32,66 @@
 #ifndef _IFAX_MODULE_H
 #define _IFAX_MODULE_H
 
+#include <ifax/types.h>
+
 /*
  * The ideas here were stolen from the EvStack concept, that was developed
  * mainly be me and Jason McMullan for the GGI project 
  * (http://www.ggi-project.org).
  */
 
+/* Data can be passed between modules by reference instead of by copying.
+ * A buffer descriptor holds a block of data taken from a common pool,
+ * along with what kind of data it is and how much of it there is.
+ * The block is reference counted; whoever holds a reference may read
+ * it, but only the sole owner of a block may modify it in place (use
+ * ifax_buffer_writable to become the sole owner).  The blocks are
+ * recycled through the pool, so no allocation is needed once the
+ * signal chain has been running for a little while.  Each thread has
+ * a pool of its own, so a buffer should stay in the thread that
+ * allocated it.
+ */
+typedef enum {
+	IFAX_FORMAT_UNKNOWN=0,
+	IFAX_FORMAT_S16=1,	/* 16-bit signed samples, length in samples */
+	IFAX_FORMAT_BITS=2,	/* Packed bits, LSB first, length in bits */
+	IFAX_FORMAT_BYTES=3	/* Plain bytes, length in bytes */
+} ifax_format;
+
+/* All pooled blocks have the same capacity.
+ */
+#define IFAX_BUFFER_BYTES	512
+#define IFAX_BUFFER_SAMPLES	(IFAX_BUFFER_BYTES/sizeof(ifax_sint16))
+#define IFAX_BUFFER_BITS	(IFAX_BUFFER_BYTES*8)
+
+typedef struct ifax_buffer {
+
+	struct ifax_buffer	*next;	/* Free list when in the pool */
+	int	refcount;		/* Number of holders */
+	ifax_format	format;		/* How to interpret the data */
+	size_t	length;			/* Amount of data, unit by format */
+	void	*data;			/* IFAX_BUFFER_BYTES of storage */
+
+} ifax_buffer;
+
+/* Statistics kept by the module layer for every module instance when
+ * it is compiled with IFAX_MODULE_STATS defined (add -DIFAX_MODULE_STATS
+ * to CFLAGS in lib/Makefile).  Without it the counters stay zero and
+ * cost nothing.  Cycles are CPU time-stamp counter ticks where that is
+ * available, clock() ticks otherwise.  The 'self' cycles don't include
+ * time spent in other modules called through the module layer.
+ */
+typedef struct ifax_module_stats {
+
+	unsigned long	input_calls;	/* handle_input/handle_buffer */
+	unsigned long	demand_calls;	/* handle_demand */
+	ifax_uint64	input_units;	/* Samples/bits/bytes received */
+	ifax_uint64	demand_units;	/* Samples/bits/bytes demanded */
+	ifax_uint64	total_cycles;	/* Including called modules */
+	ifax_uint64	self_cycles;	/* In this module alone */
+
+} ifax_module_stats;
+
 /* Every module instance creates such a control structure through which it
  * is referenced.
  */
@@ -53,6 +107,28 @@ typedef struct ifax_module {
 	 */
 	int 	(*handle_input)(struct ifax_module *self, void *data, size_t len);
 
+	/* Optional zero-copy version of 'handle_input'.  The module takes
+	 * over the reference to the buffer, and is responsible for passing
+	 * it on or releasing it.  Modules without this method are fed
+	 * through 'handle_input' by ifax_handle_buffer.
+	 */
+	int	(*handle_buffer)(struct ifax_module *self, ifax_buffer *buf);
+
+	/* Optional direct transform, used when the module is a stage in a
+	 * compiled pipeline (see pipeline.h).  Processes 'len' units of
+	 * input from 'in' into 'out' without passing anything on, and
+	 * returns the number of units produced.  At most
+	 * 'process_max(self,len)' units are produced.
+	 */
+	size_t	(*process)(struct ifax_module *self, void *in, size_t len,
+			   void *out);
+	size_t	(*process_max)(struct ifax_module *self, size_t len);
+
+	/* The data formats taken and produced by the module, or
+	 * IFAX_FORMAT_UNKNOWN when the module doesn't say.
+	 */
+	ifax_format	input_format, output_format;
+
 	/* This function is called to request data from the previous module
 	 * in the chain.  The resulting data is delivered by means of the
 	 * 'handle_input' method.
@@ -80,6 +156,13 @@ typedef struct ifax_module {
 	 */
 	struct ifax_module	*recvfrom;
 
+	/* Bookkeeping done by the module layer: The name of the module
+	 * class, a list of all module instances, and statistics.
+	 */
+	const char	*name;
+	struct ifax_module	*next_instance;
+	ifax_module_stats	stats;
+
 } ifax_module;
 
 /* A module instance is identified by that handle type.
@@ -117,10 +200,40 @@ ifax_module_id ifax_register_module_class(char *name,int (*construct)(struct ifa
  */
 ifax_modp ifax_create_module(ifax_module_id what_kind,...);
 
+/* Destroy a module instance, and free it.
+ */
+void ifax_destroy_module(ifax_modp self);
+
 /* Send input to a module. Note, that len is defined by the module.
  */
 int ifax_handle_input(struct ifax_module *self,void *data,size_t len);
 
+/* Send a buffer to a module.  The reference held by the caller is handed
+ * over to the receiving module.
+ */
+int ifax_handle_buffer(struct ifax_module *self,ifax_buffer *buf);
+
+/* Get a buffer from the pool, with room for 'length' units of data in the
+ * given format.  Returns NULL if it doesn't fit in a pooled block.
+ */
+ifax_buffer *ifax_buffer_alloc(ifax_format format,size_t length);
+
+/* Take an extra reference to a buffer, or release one.  The buffer goes
+ * back to the pool when the last reference is released.
+ */
+void ifax_buffer_ref(ifax_buffer *buf);
+void ifax_buffer_unref(ifax_buffer *buf);
+
+/* Make sure the caller is the sole owner of the buffer so it can be
+ * modified in place.  May return a copy, in which case the reference
+ * to the original is released.
+ */
+ifax_buffer *ifax_buffer_writable(ifax_buffer *buf);
+
+/* Number of bytes occupied by 'length' units of data in a given format.
+ */
+size_t ifax_buffer_bytes(ifax_format format,size_t length);
+
 /* Request data from previous modules.
  */
 void ifax_handle_demand(struct ifax_module *self, size_t len);
@@ -129,6 +242,15 @@ void ifax_handle_demand(struct ifax_module *self, size_t len);
  */
 int ifax_command(struct ifax_module *self, int command, ...);
 
+/* Print the statistics of all module instances.
+ */
+void ifax_module_stats_dump(void);
+
+/* Make a module created by other means than ifax_create_module known
+ * to the module layer (for statistics).
+ */
+void ifax_module_add_instance(struct ifax_module *self,const char *name);
+
 /* Establish a signal chain from src-module to dst-module */
 void ifax_connect(struct ifax_module *src, struct ifax_module *dst);
 
@@ -0,0 +1,50 @@
+/* $Id$
+ *
+ * Multi-channel "bank" versions of modules.
+ *
+ * A bank module does the work of several instances of a module, one
+ * for each channel (phone call), using a single module instance.  The
+ * state of all the channels is stored side by side, so one pass over
+ * a block of data does all the channels, and the tables etc. are
+ * shared between them.
+ *
+ * Data to and from a bank module is interleaved: A frame holds one
+ * unit (sample, byte of bits, ...) for each channel, and the length
+ * given to 'handle_input' and 'handle_demand' is a number of frames.
+ * Output goes interleaved to the next module in the chain, except for
+ * channels that have been given a destination of their own with
+ * CMD_BANK_SENDTO; their output is delivered to it as a normal
+ * single-channel stream.
+ */
+
+#ifndef _IFAX_MODULES_BANK_H
+#define _IFAX_MODULES_BANK_H
+
+#include <ifax/module.h>
+
+#define CMD_BANK_CHANNELS	0xFF430001	/* Returns number of channels */
+#define CMD_BANK_SENDTO		0xFF430002	/* int channel, ifax_modp dst */
+
+/* Bookkeeping shared by the bank modules */
+
+typedef struct {
+	int channels;
+	int routed;			/* Channels with own destination */
+	ifax_modp *sendto;		/* Destination of each channel */
+	ifax_uint8 *scratch;		/* For de-interleaving output */
+	size_t scratch_size;
+} ifax_bank;
+
+void bank_initialize(ifax_bank *bank, int channels);
+void bank_destroy(ifax_bank *bank);
+int bank_command(ifax_bank *bank, int cmd, va_list cmds);
+
+/* Deliver 'frames' frames of 'unit' bytes per channel */
+void bank_output(ifax_modp self, ifax_bank *bank, void *data,
+		 size_t frames, size_t unit);
+
+int fskdemod_bank_construct(ifax_modp self, va_list args);
+int modulator_V21_bank_construct(ifax_modp self, va_list args);
+int rateconvert_bank_construct(ifax_modp self, va_list args);
+
+#endif
@@ -0,0 +1,17 @@
+/* $Id$
+ *
+ * Telephone channel simulator, for testing the demodulators.
+ */
+
+#define CMD_CHANNEL_ATTENUATION		0x01	/* int dB */
+#define CMD_CHANNEL_ECHO		0x02	/* int samples, int dB */
+#define CMD_CHANNEL_FREQOFFSET		0x03	/* int 1/10 Hz */
+#define CMD_CHANNEL_JITTER		0x04	/* int Hz, int degrees */
+#define CMD_CHANNEL_NOISE		0x05	/* int dBm0 */
+#define CMD_CHANNEL_ALAW		0x06	/* int on/off */
+#define CMD_CHANNEL_SEED		0x07	/* int seed */
+
+/* Longest echo delay, in samples */
+#define CHANNEL_MAXECHO			4096
+
+int channel_construct(ifax_modp self, va_list args);
@@ -8,5 +8,22 @@
 #define HDLC_FLAG   (0x100)
 #define HDLC_CRC_OK  (0x200)
 #define HDLC_CRC_ERR (0x201)
+#define HDLC_ABORT   (0x202)
+
+/* Normally the input is one bit per byte, and the output is the codes
+ * above and the bytes of the frames as they come in.  In packed mode,
+ * the input is 8 bits to a byte (first bit in bit 0, as from the HDLC
+ * encoder) with the length given in bits.  Nothing is output; the
+ * frames are queued, and fetched with CMD_DECODE_HDLC_GETFRAME.
+ */
+#define CMD_DECODE_HDLC_PACKED   0x01	/* int on */
+#define CMD_DECODE_HDLC_FRAMES   0x02	/* Returns number of frames queued */
+
+/* ifax_uint8 *dst, int size, int *status: Copies the oldest frame
+ * without its FCS to 'dst', and stores HDLC_CRC_OK, HDLC_CRC_ERR or
+ * HDLC_ABORT in '*status'.  Returns the length of the frame, or -1 if
+ * there is none.
+ */
+#define CMD_DECODE_HDLC_GETFRAME 0x03
 
 int decode_hdlc_construct(ifax_modp self, va_list args);
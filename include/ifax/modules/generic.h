@@ -11,3 +11,10 @@
 #define CMD_GENERIC_INITIALIZE              0xFF420001
 #define CMD_GENERIC_SCRAMBLEONES            0xFF420002
 #define CMD_GENERIC_STARTPAYLOAD            0xFF420003
+
+/* These are handled by the module layer itself for all modules; see
+ * ifax_module_stats in <ifax/module.h>.  GETSTATS takes a pointer to an
+ * ifax_module_stats to fill in.
+ */
+#define CMD_GENERIC_GETSTATS                0xFF420004
+#define CMD_GENERIC_CLEARSTATS              0xFF420005
@@ -28,5 +28,15 @@
 
 #define CMD_HDLC_FRAMING_TXFRAME  0x01
 #define CMD_HDLC_FRAMING_IDLE     0x02
+#define CMD_HDLC_FRAMING_SUBMIT   0x03
+#define CMD_HDLC_FRAMING_COMPLETE 0x04
+#define CMD_HDLC_FRAMING_DEPTH    0x05
+
+/* Called when the encoder is done with the frame at 'start', and the
+ * memory may be reused.  The call is made from the thread submitting
+ * frames, during one of the commands above.
+ */
+
+typedef void (*hdlc_frame_done)(void *arg, ifax_uint8 *start);
 
 int encoder_hdlc_construct(ifax_modp self, va_list args);
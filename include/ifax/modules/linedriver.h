@@ -10,5 +10,15 @@
 #define CMD_LINEDRIVER_HARDWARE   0x03
 #define CMD_LINEDRIVER_LOOPBACK   0x04
 #define CMD_LINEDRIVER_RECORD     0x05
+#define CMD_LINEDRIVER_STATS      0x06
+
+/* Counts for the current call, or the last one when offline */
+
+typedef struct {
+  int underruns;                  /* Times the line ran out of samples */
+  int silence;                    /* Samples of silence sent instead */
+  int overruns;                   /* Samples lost on a full queue */
+  int lead, target;               /* Playout lead in samples, and target */
+} linedriver_stats;
 
 int linedriver_construct(ifax_modp self, va_list args);
@@ -0,0 +1,12 @@
+/* $Id$
+ *
+ * Monitoring of a call to a sound card, file or socket.
+ */
+
+#define CMD_MONITOR_VOLUME		0x01	/* int tx, int rx (1.0=0x10000) */
+#define CMD_MONITOR_STATS		0x02	/* unsigned long *sent, *dropped */
+
+/* Samples summed up at most when decimating */
+#define MONITOR_MAXDECIMATE		16
+
+int monitor_construct(ifax_modp self, va_list args);
@@ -9,4 +9,15 @@
 #define CMD_SCRAMBLER_SCRAM_V29         0x02
 #define CMD_SCRAMBLER_DESCR_V29         0x03
 
+/* (De)scramble 'size' bits in one go, like the whole payload of a
+ * HDLC frame, without going through the module.  The state starts
+ * out as zero and is carried on between calls.  The source and
+ * destination may be the same buffer.
+ */
+
+void scramble_V29(ifax_uint8 *src, ifax_uint8 *dst,
+		  ifax_uint32 *state, size_t size);
+void descramble_V29(ifax_uint8 *src, ifax_uint8 *dst,
+		    ifax_uint32 *state, size_t size);
+
 int scrambler_construct(ifax_modp self, va_list args);
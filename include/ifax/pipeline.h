@@ -0,0 +1,59 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Compiled pipelines of modules.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+#ifndef _IFAX_PIPELINE_H
+#define _IFAX_PIPELINE_H
+
+#include <ifax/module.h>
+
+/* A static part of a signal chain, where every module has a 'process'
+ * method, can be compiled into a pipeline.  The pipeline is a module
+ * in its own right that takes the place of the modules it was compiled
+ * from: Data sent to it is run through all the stages one block at a
+ * time in a small working buffer, and the result of the last stage is
+ * delivered in a pooled buffer to the module after the pipeline.
+ * Demands are passed up through the stages as usual.
+ *
+ * The stages are still connected to each other, so they may produce
+ * output on their own (like synchronizing sequences) and it will reach
+ * the end of the chain the ordinary way.  The stages belong to the
+ * pipeline from then on; connect the pipeline, not the stages, and
+ * give every pipeline modules of its own.
+ */
+
+#define IFAX_PIPELINE_MAXSTAGES		8
+
+/* Size of the working buffers in bytes */
+#define IFAX_PIPELINE_WORKBYTES		2048
+
+/* Compile the chain from 'first' to 'last' (following the 'sendto'
+ * pointers) into a pipeline.  The modules before and after the chain
+ * are connected to the pipeline.  Returns NULL if the chain can't be
+ * compiled, in which case nothing is changed.
+ */
+ifax_modp ifax_pipeline_compile(ifax_modp first, ifax_modp last);
+
+#endif
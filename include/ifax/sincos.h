@@ -6,5 +6,35 @@
  * (C) 1998 Morten Rolland
  */
 
+#ifndef _IFAX_SINCOS_H
+#define _IFAX_SINCOS_H
+
+#include <ifax/types.h>
+
 extern int intsin(int);
 extern int intcos(int);
+
+/* Block versions for tone and carrier generators, doing a whole run of
+ * samples in one call.  The phase 'w' is stepped by 'inc' after each
+ * sample, and the phase after the last sample is returned.  Scaled
+ * samples are (intsin(w) * scale) >> 16, so a scale of 0x10000 gives
+ * the table values themselves.
+ */
+
+/* n scaled sines */
+extern unsigned int intsin_block(ifax_sint16 *dst, int n, unsigned int w,
+				 unsigned int inc, ifax_sint32 scale);
+
+/* n unscaled cosines and sines of the same phases */
+extern unsigned int intsincos_block(ifax_sint16 *cosdst, ifax_sint16 *sindst,
+				    int n, unsigned int w, unsigned int inc);
+
+/* n scaled sines for a changing frequency: The increment after sample
+ * t is inc[t*step], so a step of 0 is a steady tone.  The samples are
+ * written 'stride' apart, for interleaved output.
+ */
+extern unsigned int intsin_sweep(ifax_sint16 *dst, int stride, int n,
+				 unsigned int w, const ifax_uint16 *inc,
+				 int step, ifax_sint32 scale);
+
+#endif
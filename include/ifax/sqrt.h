@@ -25,4 +25,8 @@
    ******************************************************************************
  */
 
+/* sqrt(x) in Q15, or 0xFFFF if x is negative */
 extern unsigned short intsqrt (short x);
+
+/* The same for 'n' values */
+extern void intsqrt_block (const short *x, unsigned short *res, int n);
@@ -45,4 +45,23 @@ typedef unsigned int ifax_uint32;
 typedef signed   int ifax_sint32;
 typedef          int ifax_int32;
 
+/* ANSI C has no 64-bit type, but GCC offers one anyway */
+#ifdef __GNUC__
+__extension__ typedef unsigned long long ifax_uint64;
+__extension__ typedef signed   long long ifax_sint64;
+#else
+typedef unsigned long ifax_uint64;
+typedef signed   long ifax_sint64;
+#endif
+
+/* Variables that every thread needs its own copy of.  The daemon may
+ * serve its lines from several threads (see amodemd.c); without GCC
+ * it has to make do with one.
+ */
+#ifdef __GNUC__
+#define IFAX_THREAD __thread
+#else
+#define IFAX_THREAD
+#endif
+
 #endif
@@ -43,6 +43,14 @@
  * The reason why there are 13 bits of significant output from 'wala2sint'
  * while there is only 12 bits of significant index to 'sint2wala' is
  * due to quantization.
+ *
+ * The array 'sint2qsint[x&0xFFF]' takes the same index as 'sint2wala', and
+ * returns the full-scale linear value it is quantized to, that is
+ *
+ *       sint2qsint[x] == (1<<3) * wala2sint[sint2wala[x]]
+ *
+ * so a transmitter can have both the a-Law code and the value actually
+ * sent without the second lookup depending on the first.
  */
 
 #include <ifax/types.h>
@@ -366,3 +374,430 @@ ifax_sint16 wala2sint[256] = {
   1184,-74,74,-848,848,-53,53,-3392,3392,-212,212,-424,424,
   -21,21,-1696,1696,-106,106
 };
+
+ifax_sint16 sint2qsint[4096] = {
+  8,24,40,56,72,88,104,120,136,152,168,184,200,216,232,248,264,280,296,
+  312,328,344,360,376,392,408,424,440,456,472,488,504,528,528,560,560,
+  592,592,624,624,656,656,688,688,720,720,752,752,784,784,816,816,848,
+  848,880,880,912,912,944,944,976,976,1008,1008,1056,1056,1056,1056,
+  1120,1120,1120,1120,1184,1184,1184,1184,1248,1248,1248,1248,1312,1312,
+  1312,1312,1376,1376,1376,1376,1440,1440,1440,1440,1504,1504,1504,1504,
+  1568,1568,1568,1568,1632,1632,1632,1632,1696,1696,1696,1696,1760,1760,
+  1760,1760,1824,1824,1824,1824,1888,1888,1888,1888,1952,1952,1952,1952,
+  2016,2016,2016,2016,2112,2112,2112,2112,2112,2112,2112,2112,2240,2240,
+  2240,2240,2240,2240,2240,2240,2368,2368,2368,2368,2368,2368,2368,2368,
+  2496,2496,2496,2496,2496,2496,2496,2496,2624,2624,2624,2624,2624,2624,
+  2624,2624,2752,2752,2752,2752,2752,2752,2752,2752,2880,2880,2880,2880,
+  2880,2880,2880,2880,3008,3008,3008,3008,3008,3008,3008,3008,3136,3136,
+  3136,3136,3136,3136,3136,3136,3264,3264,3264,3264,3264,3264,3264,3264,
+  3392,3392,3392,3392,3392,3392,3392,3392,3520,3520,3520,3520,3520,3520,
+  3520,3520,3648,3648,3648,3648,3648,3648,3648,3648,3776,3776,3776,3776,
+  3776,3776,3776,3776,3904,3904,3904,3904,3904,3904,3904,3904,4032,4032,
+  4032,4032,4032,4032,4032,4032,4224,4224,4224,4224,4224,4224,4224,4224,
+  4224,4224,4224,4224,4224,4224,4224,4224,4480,4480,4480,4480,4480,4480,
+  4480,4480,4480,4480,4480,4480,4480,4480,4480,4480,4736,4736,4736,4736,
+  4736,4736,4736,4736,4736,4736,4736,4736,4736,4736,4736,4736,4992,4992,
+  4992,4992,4992,4992,4992,4992,4992,4992,4992,4992,4992,4992,4992,4992,
+  5248,5248,5248,5248,5248,5248,5248,5248,5248,5248,5248,5248,5248,5248,
+  5248,5248,5504,5504,5504,5504,5504,5504,5504,5504,5504,5504,5504,5504,
+  5504,5504,5504,5504,5760,5760,5760,5760,5760,5760,5760,5760,5760,5760,
+  5760,5760,5760,5760,5760,5760,6016,6016,6016,6016,6016,6016,6016,6016,
+  6016,6016,6016,6016,6016,6016,6016,6016,6272,6272,6272,6272,6272,6272,
+  6272,6272,6272,6272,6272,6272,6272,6272,6272,6272,6528,6528,6528,6528,
+  6528,6528,6528,6528,6528,6528,6528,6528,6528,6528,6528,6528,6784,6784,
+  6784,6784,6784,6784,6784,6784,6784,6784,6784,6784,6784,6784,6784,6784,
+  7040,7040,7040,7040,7040,7040,7040,7040,7040,7040,7040,7040,7040,7040,
+  7040,7040,7296,7296,7296,7296,7296,7296,7296,7296,7296,7296,7296,7296,
+  7296,7296,7296,7296,7552,7552,7552,7552,7552,7552,7552,7552,7552,7552,
+  7552,7552,7552,7552,7552,7552,7808,7808,7808,7808,7808,7808,7808,7808,
+  7808,7808,7808,7808,7808,7808,7808,7808,8064,8064,8064,8064,8064,8064,
+  8064,8064,8064,8064,8064,8064,8064,8064,8064,8064,8448,8448,8448,8448,
+  8448,8448,8448,8448,8448,8448,8448,8448,8448,8448,8448,8448,8448,8448,
+  8448,8448,8448,8448,8448,8448,8448,8448,8448,8448,8448,8448,8448,8448,
+  8960,8960,8960,8960,8960,8960,8960,8960,8960,8960,8960,8960,8960,8960,
+  8960,8960,8960,8960,8960,8960,8960,8960,8960,8960,8960,8960,8960,8960,
+  8960,8960,8960,8960,9472,9472,9472,9472,9472,9472,9472,9472,9472,9472,
+  9472,9472,9472,9472,9472,9472,9472,9472,9472,9472,9472,9472,9472,9472,
+  9472,9472,9472,9472,9472,9472,9472,9472,9984,9984,9984,9984,9984,9984,
+  9984,9984,9984,9984,9984,9984,9984,9984,9984,9984,9984,9984,9984,9984,
+  9984,9984,9984,9984,9984,9984,9984,9984,9984,9984,9984,9984,10496,
+  10496,10496,10496,10496,10496,10496,10496,10496,10496,10496,10496,
+  10496,10496,10496,10496,10496,10496,10496,10496,10496,10496,10496,
+  10496,10496,10496,10496,10496,10496,10496,10496,10496,11008,11008,
+  11008,11008,11008,11008,11008,11008,11008,11008,11008,11008,11008,
+  11008,11008,11008,11008,11008,11008,11008,11008,11008,11008,11008,
+  11008,11008,11008,11008,11008,11008,11008,11008,11520,11520,11520,
+  11520,11520,11520,11520,11520,11520,11520,11520,11520,11520,11520,
+  11520,11520,11520,11520,11520,11520,11520,11520,11520,11520,11520,
+  11520,11520,11520,11520,11520,11520,11520,12032,12032,12032,12032,
+  12032,12032,12032,12032,12032,12032,12032,12032,12032,12032,12032,
+  12032,12032,12032,12032,12032,12032,12032,12032,12032,12032,12032,
+  12032,12032,12032,12032,12032,12032,12544,12544,12544,12544,12544,
+  12544,12544,12544,12544,12544,12544,12544,12544,12544,12544,12544,
+  12544,12544,12544,12544,12544,12544,12544,12544,12544,12544,12544,
+  12544,12544,12544,12544,12544,13056,13056,13056,13056,13056,13056,
+  13056,13056,13056,13056,13056,13056,13056,13056,13056,13056,13056,
+  13056,13056,13056,13056,13056,13056,13056,13056,13056,13056,13056,
+  13056,13056,13056,13056,13568,13568,13568,13568,13568,13568,13568,
+  13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,
+  13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,13568,
+  13568,13568,13568,14080,14080,14080,14080,14080,14080,14080,14080,
+  14080,14080,14080,14080,14080,14080,14080,14080,14080,14080,14080,
+  14080,14080,14080,14080,14080,14080,14080,14080,14080,14080,14080,
+  14080,14080,14592,14592,14592,14592,14592,14592,14592,14592,14592,
+  14592,14592,14592,14592,14592,14592,14592,14592,14592,14592,14592,
+  14592,14592,14592,14592,14592,14592,14592,14592,14592,14592,14592,
+  14592,15104,15104,15104,15104,15104,15104,15104,15104,15104,15104,
+  15104,15104,15104,15104,15104,15104,15104,15104,15104,15104,15104,
+  15104,15104,15104,15104,15104,15104,15104,15104,15104,15104,15104,
+  15616,15616,15616,15616,15616,15616,15616,15616,15616,15616,15616,
+  15616,15616,15616,15616,15616,15616,15616,15616,15616,15616,15616,
+  15616,15616,15616,15616,15616,15616,15616,15616,15616,15616,16128,
+  16128,16128,16128,16128,16128,16128,16128,16128,16128,16128,16128,
+  16128,16128,16128,16128,16128,16128,16128,16128,16128,16128,16128,
+  16128,16128,16128,16128,16128,16128,16128,16128,16128,16896,16896,
+  16896,16896,16896,16896,16896,16896,16896,16896,16896,16896,16896,
+  16896,16896,16896,16896,16896,16896,16896,16896,16896,16896,16896,
+  16896,16896,16896,16896,16896,16896,16896,16896,16896,16896,16896,
+  16896,16896,16896,16896,16896,16896,16896,16896,16896,16896,16896,
+  16896,16896,16896,16896,16896,16896,16896,16896,16896,16896,16896,
+  16896,16896,16896,16896,16896,16896,16896,17920,17920,17920,17920,
+  17920,17920,17920,17920,17920,17920,17920,17920,17920,17920,17920,
+  17920,17920,17920,17920,17920,17920,17920,17920,17920,17920,17920,
+  17920,17920,17920,17920,17920,17920,17920,17920,17920,17920,17920,
+  17920,17920,17920,17920,17920,17920,17920,17920,17920,17920,17920,
+  17920,17920,17920,17920,17920,17920,17920,17920,17920,17920,17920,
+  17920,17920,17920,17920,17920,18944,18944,18944,18944,18944,18944,
+  18944,18944,18944,18944,18944,18944,18944,18944,18944,18944,18944,
+  18944,18944,18944,18944,18944,18944,18944,18944,18944,18944,18944,
+  18944,18944,18944,18944,18944,18944,18944,18944,18944,18944,18944,
+  18944,18944,18944,18944,18944,18944,18944,18944,18944,18944,18944,
+  18944,18944,18944,18944,18944,18944,18944,18944,18944,18944,18944,
+  18944,18944,18944,19968,19968,19968,19968,19968,19968,19968,19968,
+  19968,19968,19968,19968,19968,19968,19968,19968,19968,19968,19968,
+  19968,19968,19968,19968,19968,19968,19968,19968,19968,19968,19968,
+  19968,19968,19968,19968,19968,19968,19968,19968,19968,19968,19968,
+  19968,19968,19968,19968,19968,19968,19968,19968,19968,19968,19968,
+  19968,19968,19968,19968,19968,19968,19968,19968,19968,19968,19968,
+  19968,20992,20992,20992,20992,20992,20992,20992,20992,20992,20992,
+  20992,20992,20992,20992,20992,20992,20992,20992,20992,20992,20992,
+  20992,20992,20992,20992,20992,20992,20992,20992,20992,20992,20992,
+  20992,20992,20992,20992,20992,20992,20992,20992,20992,20992,20992,
+  20992,20992,20992,20992,20992,20992,20992,20992,20992,20992,20992,
+  20992,20992,20992,20992,20992,20992,20992,20992,20992,20992,22016,
+  22016,22016,22016,22016,22016,22016,22016,22016,22016,22016,22016,
+  22016,22016,22016,22016,22016,22016,22016,22016,22016,22016,22016,
+  22016,22016,22016,22016,22016,22016,22016,22016,22016,22016,22016,
+  22016,22016,22016,22016,22016,22016,22016,22016,22016,22016,22016,
+  22016,22016,22016,22016,22016,22016,22016,22016,22016,22016,22016,
+  22016,22016,22016,22016,22016,22016,22016,22016,23040,23040,23040,
+  23040,23040,23040,23040,23040,23040,23040,23040,23040,23040,23040,
+  23040,23040,23040,23040,23040,23040,23040,23040,23040,23040,23040,
+  23040,23040,23040,23040,23040,23040,23040,23040,23040,23040,23040,
+  23040,23040,23040,23040,23040,23040,23040,23040,23040,23040,23040,
+  23040,23040,23040,23040,23040,23040,23040,23040,23040,23040,23040,
+  23040,23040,23040,23040,23040,23040,24064,24064,24064,24064,24064,
+  24064,24064,24064,24064,24064,24064,24064,24064,24064,24064,24064,
+  24064,24064,24064,24064,24064,24064,24064,24064,24064,24064,24064,
+  24064,24064,24064,24064,24064,24064,24064,24064,24064,24064,24064,
+  24064,24064,24064,24064,24064,24064,24064,24064,24064,24064,24064,
+  24064,24064,24064,24064,24064,24064,24064,24064,24064,24064,24064,
+  24064,24064,24064,24064,25088,25088,25088,25088,25088,25088,25088,
+  25088,25088,25088,25088,25088,25088,25088,25088,25088,25088,25088,
+  25088,25088,25088,25088,25088,25088,25088,25088,25088,25088,25088,
+  25088,25088,25088,25088,25088,25088,25088,25088,25088,25088,25088,
+  25088,25088,25088,25088,25088,25088,25088,25088,25088,25088,25088,
+  25088,25088,25088,25088,25088,25088,25088,25088,25088,25088,25088,
+  25088,25088,26112,26112,26112,26112,26112,26112,26112,26112,26112,
+  26112,26112,26112,26112,26112,26112,26112,26112,26112,26112,26112,
+  26112,26112,26112,26112,26112,26112,26112,26112,26112,26112,26112,
+  26112,26112,26112,26112,26112,26112,26112,26112,26112,26112,26112,
+  26112,26112,26112,26112,26112,26112,26112,26112,26112,26112,26112,
+  26112,26112,26112,26112,26112,26112,26112,26112,26112,26112,26112,
+  27136,27136,27136,27136,27136,27136,27136,27136,27136,27136,27136,
+  27136,27136,27136,27136,27136,27136,27136,27136,27136,27136,27136,
+  27136,27136,27136,27136,27136,27136,27136,27136,27136,27136,27136,
+  27136,27136,27136,27136,27136,27136,27136,27136,27136,27136,27136,
+  27136,27136,27136,27136,27136,27136,27136,27136,27136,27136,27136,
+  27136,27136,27136,27136,27136,27136,27136,27136,27136,28160,28160,
+  28160,28160,28160,28160,28160,28160,28160,28160,28160,28160,28160,
+  28160,28160,28160,28160,28160,28160,28160,28160,28160,28160,28160,
+  28160,28160,28160,28160,28160,28160,28160,28160,28160,28160,28160,
+  28160,28160,28160,28160,28160,28160,28160,28160,28160,28160,28160,
+  28160,28160,28160,28160,28160,28160,28160,28160,28160,28160,28160,
+  28160,28160,28160,28160,28160,28160,28160,29184,29184,29184,29184,
+  29184,29184,29184,29184,29184,29184,29184,29184,29184,29184,29184,
+  29184,29184,29184,29184,29184,29184,29184,29184,29184,29184,29184,
+  29184,29184,29184,29184,29184,29184,29184,29184,29184,29184,29184,
+  29184,29184,29184,29184,29184,29184,29184,29184,29184,29184,29184,
+  29184,29184,29184,29184,29184,29184,29184,29184,29184,29184,29184,
+  29184,29184,29184,29184,29184,30208,30208,30208,30208,30208,30208,
+  30208,30208,30208,30208,30208,30208,30208,30208,30208,30208,30208,
+  30208,30208,30208,30208,30208,30208,30208,30208,30208,30208,30208,
+  30208,30208,30208,30208,30208,30208,30208,30208,30208,30208,30208,
+  30208,30208,30208,30208,30208,30208,30208,30208,30208,30208,30208,
+  30208,30208,30208,30208,30208,30208,30208,30208,30208,30208,30208,
+  30208,30208,30208,31232,31232,31232,31232,31232,31232,31232,31232,
+  31232,31232,31232,31232,31232,31232,31232,31232,31232,31232,31232,
+  31232,31232,31232,31232,31232,31232,31232,31232,31232,31232,31232,
+  31232,31232,31232,31232,31232,31232,31232,31232,31232,31232,31232,
+  31232,31232,31232,31232,31232,31232,31232,31232,31232,31232,31232,
+  31232,31232,31232,31232,31232,31232,31232,31232,31232,31232,31232,
+  31232,32256,32256,32256,32256,32256,32256,32256,32256,32256,32256,
+  32256,32256,32256,32256,32256,32256,32256,32256,32256,32256,32256,
+  32256,32256,32256,32256,32256,32256,32256,32256,32256,32256,32256,
+  32256,32256,32256,32256,32256,32256,32256,32256,32256,32256,32256,
+  32256,32256,32256,32256,32256,32256,32256,32256,32256,32256,32256,
+  32256,32256,32256,32256,32256,32256,32256,32256,32256,32256,-32256,
+  -32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,
+  -32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,
+  -32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,
+  -32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,
+  -32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,
+  -32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,-32256,
+  -32256,-32256,-32256,-31232,-31232,-31232,-31232,-31232,-31232,-31232,
+  -31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,
+  -31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,
+  -31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,
+  -31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,
+  -31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,-31232,
+  -31232,-31232,-31232,-31232,-31232,-31232,-31232,-30208,-30208,-30208,
+  -30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,
+  -30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,
+  -30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,
+  -30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,
+  -30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,
+  -30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,-30208,
+  -30208,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,
+  -29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,
+  -29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,
+  -29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,
+  -29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,
+  -29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,-29184,
+  -29184,-29184,-29184,-29184,-29184,-28160,-28160,-28160,-28160,-28160,
+  -28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,
+  -28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,
+  -28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,
+  -28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,
+  -28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,
+  -28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-28160,-27136,
+  -27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,
+  -27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,
+  -27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,
+  -27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,
+  -27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,
+  -27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,-27136,
+  -27136,-27136,-27136,-26112,-26112,-26112,-26112,-26112,-26112,-26112,
+  -26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,
+  -26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,
+  -26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,
+  -26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,
+  -26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,-26112,
+  -26112,-26112,-26112,-26112,-26112,-26112,-26112,-25088,-25088,-25088,
+  -25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,
+  -25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,
+  -25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,
+  -25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,
+  -25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,
+  -25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,-25088,
+  -25088,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,
+  -24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,
+  -24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,
+  -24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,
+  -24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,
+  -24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,-24064,
+  -24064,-24064,-24064,-24064,-24064,-23040,-23040,-23040,-23040,-23040,
+  -23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,
+  -23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,
+  -23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,
+  -23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,
+  -23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,
+  -23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-23040,-22016,
+  -22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,
+  -22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,
+  -22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,
+  -22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,
+  -22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,
+  -22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,-22016,
+  -22016,-22016,-22016,-20992,-20992,-20992,-20992,-20992,-20992,-20992,
+  -20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,
+  -20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,
+  -20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,
+  -20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,
+  -20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,-20992,
+  -20992,-20992,-20992,-20992,-20992,-20992,-20992,-19968,-19968,-19968,
+  -19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,
+  -19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,
+  -19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,
+  -19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,
+  -19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,
+  -19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,-19968,
+  -19968,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,
+  -18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,
+  -18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,
+  -18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,
+  -18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,
+  -18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,-18944,
+  -18944,-18944,-18944,-18944,-18944,-17920,-17920,-17920,-17920,-17920,
+  -17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,
+  -17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,
+  -17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,
+  -17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,
+  -17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,
+  -17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-17920,-16896,
+  -16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,
+  -16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,
+  -16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,
+  -16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,
+  -16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,
+  -16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,-16896,
+  -16896,-16896,-16896,-16128,-16128,-16128,-16128,-16128,-16128,-16128,
+  -16128,-16128,-16128,-16128,-16128,-16128,-16128,-16128,-16128,-16128,
+  -16128,-16128,-16128,-16128,-16128,-16128,-16128,-16128,-16128,-16128,
+  -16128,-16128,-16128,-16128,-16128,-15616,-15616,-15616,-15616,-15616,
+  -15616,-15616,-15616,-15616,-15616,-15616,-15616,-15616,-15616,-15616,
+  -15616,-15616,-15616,-15616,-15616,-15616,-15616,-15616,-15616,-15616,
+  -15616,-15616,-15616,-15616,-15616,-15616,-15616,-15104,-15104,-15104,
+  -15104,-15104,-15104,-15104,-15104,-15104,-15104,-15104,-15104,-15104,
+  -15104,-15104,-15104,-15104,-15104,-15104,-15104,-15104,-15104,-15104,
+  -15104,-15104,-15104,-15104,-15104,-15104,-15104,-15104,-15104,-14592,
+  -14592,-14592,-14592,-14592,-14592,-14592,-14592,-14592,-14592,-14592,
+  -14592,-14592,-14592,-14592,-14592,-14592,-14592,-14592,-14592,-14592,
+  -14592,-14592,-14592,-14592,-14592,-14592,-14592,-14592,-14592,-14592,
+  -14592,-14080,-14080,-14080,-14080,-14080,-14080,-14080,-14080,-14080,
+  -14080,-14080,-14080,-14080,-14080,-14080,-14080,-14080,-14080,-14080,
+  -14080,-14080,-14080,-14080,-14080,-14080,-14080,-14080,-14080,-14080,
+  -14080,-14080,-14080,-13568,-13568,-13568,-13568,-13568,-13568,-13568,
+  -13568,-13568,-13568,-13568,-13568,-13568,-13568,-13568,-13568,-13568,
+  -13568,-13568,-13568,-13568,-13568,-13568,-13568,-13568,-13568,-13568,
+  -13568,-13568,-13568,-13568,-13568,-13056,-13056,-13056,-13056,-13056,
+  -13056,-13056,-13056,-13056,-13056,-13056,-13056,-13056,-13056,-13056,
+  -13056,-13056,-13056,-13056,-13056,-13056,-13056,-13056,-13056,-13056,
+  -13056,-13056,-13056,-13056,-13056,-13056,-13056,-12544,-12544,-12544,
+  -12544,-12544,-12544,-12544,-12544,-12544,-12544,-12544,-12544,-12544,
+  -12544,-12544,-12544,-12544,-12544,-12544,-12544,-12544,-12544,-12544,
+  -12544,-12544,-12544,-12544,-12544,-12544,-12544,-12544,-12544,-12032,
+  -12032,-12032,-12032,-12032,-12032,-12032,-12032,-12032,-12032,-12032,
+  -12032,-12032,-12032,-12032,-12032,-12032,-12032,-12032,-12032,-12032,
+  -12032,-12032,-12032,-12032,-12032,-12032,-12032,-12032,-12032,-12032,
+  -12032,-11520,-11520,-11520,-11520,-11520,-11520,-11520,-11520,-11520,
+  -11520,-11520,-11520,-11520,-11520,-11520,-11520,-11520,-11520,-11520,
+  -11520,-11520,-11520,-11520,-11520,-11520,-11520,-11520,-11520,-11520,
+  -11520,-11520,-11520,-11008,-11008,-11008,-11008,-11008,-11008,-11008,
+  -11008,-11008,-11008,-11008,-11008,-11008,-11008,-11008,-11008,-11008,
+  -11008,-11008,-11008,-11008,-11008,-11008,-11008,-11008,-11008,-11008,
+  -11008,-11008,-11008,-11008,-11008,-10496,-10496,-10496,-10496,-10496,
+  -10496,-10496,-10496,-10496,-10496,-10496,-10496,-10496,-10496,-10496,
+  -10496,-10496,-10496,-10496,-10496,-10496,-10496,-10496,-10496,-10496,
+  -10496,-10496,-10496,-10496,-10496,-10496,-10496,-9984,-9984,-9984,
+  -9984,-9984,-9984,-9984,-9984,-9984,-9984,-9984,-9984,-9984,-9984,
+  -9984,-9984,-9984,-9984,-9984,-9984,-9984,-9984,-9984,-9984,-9984,
+  -9984,-9984,-9984,-9984,-9984,-9984,-9984,-9472,-9472,-9472,-9472,
+  -9472,-9472,-9472,-9472,-9472,-9472,-9472,-9472,-9472,-9472,-9472,
+  -9472,-9472,-9472,-9472,-9472,-9472,-9472,-9472,-9472,-9472,-9472,
+  -9472,-9472,-9472,-9472,-9472,-9472,-8960,-8960,-8960,-8960,-8960,
+  -8960,-8960,-8960,-8960,-8960,-8960,-8960,-8960,-8960,-8960,-8960,
+  -8960,-8960,-8960,-8960,-8960,-8960,-8960,-8960,-8960,-8960,-8960,
+  -8960,-8960,-8960,-8960,-8960,-8448,-8448,-8448,-8448,-8448,-8448,
+  -8448,-8448,-8448,-8448,-8448,-8448,-8448,-8448,-8448,-8448,-8448,
+  -8448,-8448,-8448,-8448,-8448,-8448,-8448,-8448,-8448,-8448,-8448,
+  -8448,-8448,-8448,-8448,-8064,-8064,-8064,-8064,-8064,-8064,-8064,
+  -8064,-8064,-8064,-8064,-8064,-8064,-8064,-8064,-8064,-7808,-7808,
+  -7808,-7808,-7808,-7808,-7808,-7808,-7808,-7808,-7808,-7808,-7808,
+  -7808,-7808,-7808,-7552,-7552,-7552,-7552,-7552,-7552,-7552,-7552,
+  -7552,-7552,-7552,-7552,-7552,-7552,-7552,-7552,-7296,-7296,-7296,
+  -7296,-7296,-7296,-7296,-7296,-7296,-7296,-7296,-7296,-7296,-7296,
+  -7296,-7296,-7040,-7040,-7040,-7040,-7040,-7040,-7040,-7040,-7040,
+  -7040,-7040,-7040,-7040,-7040,-7040,-7040,-6784,-6784,-6784,-6784,
+  -6784,-6784,-6784,-6784,-6784,-6784,-6784,-6784,-6784,-6784,-6784,
+  -6784,-6528,-6528,-6528,-6528,-6528,-6528,-6528,-6528,-6528,-6528,
+  -6528,-6528,-6528,-6528,-6528,-6528,-6272,-6272,-6272,-6272,-6272,
+  -6272,-6272,-6272,-6272,-6272,-6272,-6272,-6272,-6272,-6272,-6272,
+  -6016,-6016,-6016,-6016,-6016,-6016,-6016,-6016,-6016,-6016,-6016,
+  -6016,-6016,-6016,-6016,-6016,-5760,-5760,-5760,-5760,-5760,-5760,
+  -5760,-5760,-5760,-5760,-5760,-5760,-5760,-5760,-5760,-5760,-5504,
+  -5504,-5504,-5504,-5504,-5504,-5504,-5504,-5504,-5504,-5504,-5504,
+  -5504,-5504,-5504,-5504,-5248,-5248,-5248,-5248,-5248,-5248,-5248,
+  -5248,-5248,-5248,-5248,-5248,-5248,-5248,-5248,-5248,-4992,-4992,
+  -4992,-4992,-4992,-4992,-4992,-4992,-4992,-4992,-4992,-4992,-4992,
+  -4992,-4992,-4992,-4736,-4736,-4736,-4736,-4736,-4736,-4736,-4736,
+  -4736,-4736,-4736,-4736,-4736,-4736,-4736,-4736,-4480,-4480,-4480,
+  -4480,-4480,-4480,-4480,-4480,-4480,-4480,-4480,-4480,-4480,-4480,
+  -4480,-4480,-4224,-4224,-4224,-4224,-4224,-4224,-4224,-4224,-4224,
+  -4224,-4224,-4224,-4224,-4224,-4224,-4224,-4032,-4032,-4032,-4032,
+  -4032,-4032,-4032,-4032,-3904,-3904,-3904,-3904,-3904,-3904,-3904,
+  -3904,-3776,-3776,-3776,-3776,-3776,-3776,-3776,-3776,-3648,-3648,
+  -3648,-3648,-3648,-3648,-3648,-3648,-3520,-3520,-3520,-3520,-3520,
+  -3520,-3520,-3520,-3392,-3392,-3392,-3392,-3392,-3392,-3392,-3392,
+  -3264,-3264,-3264,-3264,-3264,-3264,-3264,-3264,-3136,-3136,-3136,
+  -3136,-3136,-3136,-3136,-3136,-3008,-3008,-3008,-3008,-3008,-3008,
+  -3008,-3008,-2880,-2880,-2880,-2880,-2880,-2880,-2880,-2880,-2752,
+  -2752,-2752,-2752,-2752,-2752,-2752,-2752,-2624,-2624,-2624,-2624,
+  -2624,-2624,-2624,-2624,-2496,-2496,-2496,-2496,-2496,-2496,-2496,
+  -2496,-2368,-2368,-2368,-2368,-2368,-2368,-2368,-2368,-2240,-2240,
+  -2240,-2240,-2240,-2240,-2240,-2240,-2112,-2112,-2112,-2112,-2112,
+  -2112,-2112,-2112,-2016,-2016,-2016,-2016,-1952,-1952,-1952,-1952,
+  -1888,-1888,-1888,-1888,-1824,-1824,-1824,-1824,-1760,-1760,-1760,
+  -1760,-1696,-1696,-1696,-1696,-1632,-1632,-1632,-1632,-1568,-1568,
+  -1568,-1568,-1504,-1504,-1504,-1504,-1440,-1440,-1440,-1440,-1376,
+  -1376,-1376,-1376,-1312,-1312,-1312,-1312,-1248,-1248,-1248,-1248,
+  -1184,-1184,-1184,-1184,-1120,-1120,-1120,-1120,-1056,-1056,-1056,
+  -1056,-1008,-1008,-976,-976,-944,-944,-912,-912,-880,-880,-848,-848,
+  -816,-816,-784,-784,-752,-752,-720,-720,-688,-688,-656,-656,-624,-624,
+  -592,-592,-560,-560,-528,-528,-504,-488,-472,-456,-440,-424,-408,-392,
+  -376,-360,-344,-328,-312,-296,-280,-264,-248,-232,-216,-200,-184,-168,
+  -152,-136,-120,-104,-88,-72,-56,-40,-24,-8
+};
+
+
+/* Convert 'cnt' linear samples to bit-reversed a-Law codes in 'dst', and
+ * replace every sample by the value it is quantized to.  Four samples
+ * are done at a time, so the lookups can overlap.
+ */
+
+void sint2wala_block(ifax_sint16 *src, ifax_uint8 *dst, int cnt)
+{
+  unsigned int i0, i1, i2, i3;
+
+  while ( cnt >= 4 ) {
+    i0 = ((ifax_uint16)src[0]) >> 4;
+    i1 = ((ifax_uint16)src[1]) >> 4;
+    i2 = ((ifax_uint16)src[2]) >> 4;
+    i3 = ((ifax_uint16)src[3]) >> 4;
+    dst[0] = sint2wala[i0];
+    dst[1] = sint2wala[i1];
+    dst[2] = sint2wala[i2];
+    dst[3] = sint2wala[i3];
+    src[0] = sint2qsint[i0];
+    src[1] = sint2qsint[i1];
+    src[2] = sint2qsint[i2];
+    src[3] = sint2qsint[i3];
+    src += 4;
+    dst += 4;
+    cnt -= 4;
+  }
+
+  while ( cnt-- > 0 ) {
+    i0 = ((ifax_uint16)*src) >> 4;
+    *dst++ = sint2wala[i0];
+    *src++ = sint2qsint[i0];
+  }
+}
+
+/* Convert 'cnt' bit-reversed a-Law codes to full-scale linear samples */
+
+void wala2sint_block(ifax_uint8 *src, ifax_sint16 *dst, int cnt)
+{
+  while ( cnt >= 4 ) {
+    dst[0] = 8 * wala2sint[src[0]];
+    dst[1] = 8 * wala2sint[src[1]];
+    dst[2] = 8 * wala2sint[src[2]];
+    dst[3] = 8 * wala2sint[src[3]];
+    src += 4;
+    dst += 4;
+    cnt -= 4;
+  }
+
+  while ( cnt-- > 0 )
+    *dst++ = 8 * wala2sint[*src++];
+}
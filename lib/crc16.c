@@ -0,0 +1,243 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   CRC-16/CCITT frame check sequence of HDLC frames.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+/* The register is kept bit-reversed, so the bytes are shifted in from
+ * the top with the least significant bit first, as they are sent.
+ *
+ * Slicing-by-8 handles eight bytes per step with eight tables, where
+ * table k gives the effect of a byte followed by k zero bytes.  Only
+ * the first two bytes of a step are mixed with the register, the rest
+ * are looked up directly, so the lookups are independent of each other.
+ *
+ * The carry-less multiply version folds the frame 16 bytes at a time:
+ * A block followed by 128 more bits is congruent, modulo the CRC
+ * polynomial, to its two 64-bit halves multiplied by x^192 and x^128
+ * mod P.  These products are only 80 bits long, and take the place of
+ * the block in front of the next one.  The remaining block and the
+ * tail of the frame are run through slicing-by-8.  With the bits
+ * reflected, the product of two 64-bit numbers comes out one bit
+ * short, so the constants used are x^191 and x^127 mod P instead.
+ *
+ * The tables and constants are set up on the first call.
+ */
+
+#include <stddef.h>
+
+#include <ifax/types.h>
+#include <ifax/crc16.h>
+
+#if defined(__GNUC__) && __GNUC__ >= 5 \
+    && (defined(__x86_64__) || defined(__i386__))
+#define CRC16_CLMUL
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+#define POLY		0x1021		/* x^16 + x^12 + x^5 + 1 */
+#define POLY_REFLECTED	0x8408
+
+static ifax_uint16 table[8][256];
+static ifax_uint16 (*engine)(ifax_uint16, const ifax_uint8 *, size_t);
+static const char *engine_name;
+
+#ifdef CRC16_CLMUL
+static int have_clmul;
+static ifax_uint32 fold_hi, fold_lo;	/* x^191 and x^127 mod P */
+#endif
+
+
+/* x^n mod P, in normal bit order */
+
+static ifax_uint16 xpow_mod(int n)
+{
+  ifax_uint32 r = 1;
+
+  while ( n-- > 0 ) {
+    r <<= 1;
+    if ( r & 0x10000 )
+      r ^= 0x10000 | POLY;
+  }
+  return r;
+}
+
+static ifax_uint16 reflect16(ifax_uint16 v)
+{
+  ifax_uint16 r = 0;
+  int b;
+
+  for ( b=0; b < 16; b++ )
+    if ( v & (1<<b) )
+      r |= 0x8000 >> b;
+  return r;
+}
+
+static void setup(void)
+{
+  ifax_uint16 (*choice)(ifax_uint16, const ifax_uint8 *, size_t);
+  ifax_uint16 crc;
+  int b, k, i;
+
+  for ( b=0; b < 256; b++ ) {
+    crc = b;
+    for ( i=0; i < 8; i++ )
+      crc = (crc & 1) ? (crc >> 1) ^ POLY_REFLECTED : crc >> 1;
+    table[0][b] = crc;
+  }
+  for ( k=1; k < 8; k++ )
+    for ( b=0; b < 256; b++ )
+      table[k][b] = (table[k-1][b] >> 8) ^ table[0][table[k-1][b] & 0xff];
+
+  choice = ifax_crc16_slice8;
+  engine_name = "slicing-by-8";
+
+#ifdef CRC16_CLMUL
+  {
+    unsigned int eax, ebx, ecx, edx;
+
+    /* A degree d coefficient goes in bit 63-d of the 64-bit operand */
+    fold_hi = (ifax_uint32)reflect16(xpow_mod(191)) << 16;
+    fold_lo = (ifax_uint32)reflect16(xpow_mod(127)) << 16;
+
+    if ( __get_cpuid(1,&eax,&ebx,&ecx,&edx) && (ecx & bit_PCLMUL) ) {
+      have_clmul = 1;
+      choice = ifax_crc16_clmul;
+      engine_name = "carry-less multiply";
+    }
+  }
+#endif
+
+  /* Last, as it tells the others that all is ready */
+  engine = choice;
+}
+
+ifax_uint16 ifax_crc16_bytewise(ifax_uint16 crc, const ifax_uint8 *data,
+				size_t length)
+{
+  if ( engine == 0 )
+    setup();
+
+  while ( length-- > 0 )
+    crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xff];
+
+  return crc;
+}
+
+ifax_uint16 ifax_crc16_slice8(ifax_uint16 crc, const ifax_uint8 *data,
+			      size_t length)
+{
+  if ( engine == 0 )
+    setup();
+
+  while ( length >= 8 ) {
+    crc ^= data[0] | (data[1] << 8);
+    crc = table[7][crc & 0xff] ^ table[6][crc >> 8]
+      ^ table[5][data[2]] ^ table[4][data[3]]
+      ^ table[3][data[4]] ^ table[2][data[5]]
+      ^ table[1][data[6]] ^ table[0][data[7]];
+    data += 8;
+    length -= 8;
+  }
+
+  while ( length-- > 0 )
+    crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xff];
+
+  return crc;
+}
+
+#ifdef CRC16_CLMUL
+
+__attribute__((target("pclmul,sse2")))
+static ifax_uint16 fold(ifax_uint16 crc, const ifax_uint8 *data,
+			size_t length)
+{
+  __m128i x, k;
+  ifax_uint8 rest[16];
+
+  /* The register goes into the first two bytes of the frame */
+  k = _mm_set_epi32(fold_lo,0,fold_hi,0);
+  x = _mm_loadu_si128((const __m128i *)data);
+  x = _mm_xor_si128(x,_mm_cvtsi32_si128(crc));
+  data += 16;
+  length -= 16;
+
+  while ( length >= 16 ) {
+    x = _mm_xor_si128(_mm_clmulepi64_si128(x,k,0x00),
+		      _mm_clmulepi64_si128(x,k,0x11));
+    x = _mm_xor_si128(x,_mm_loadu_si128((const __m128i *)data));
+    data += 16;
+    length -= 16;
+  }
+
+  _mm_storeu_si128((__m128i *)rest,x);
+  crc = ifax_crc16_slice8(0,rest,16);
+
+  return ifax_crc16_slice8(crc,data,length);
+}
+
+#endif
+
+ifax_uint16 ifax_crc16_clmul(ifax_uint16 crc, const ifax_uint8 *data,
+			     size_t length)
+{
+  if ( engine == 0 )
+    setup();
+
+#ifdef CRC16_CLMUL
+  /* Short frames are not worth the set up */
+  if ( have_clmul && length >= 32 )
+    return fold(crc,data,length);
+#endif
+
+  return ifax_crc16_slice8(crc,data,length);
+}
+
+ifax_uint16 ifax_crc16_update(ifax_uint16 crc, const ifax_uint8 *data,
+			      size_t length)
+{
+  if ( engine == 0 )
+    setup();
+
+  return engine(crc,data,length);
+}
+
+ifax_uint16 ifax_crc16(const ifax_uint8 *data, size_t length)
+{
+  return ifax_crc16_update(IFAX_CRC16_INIT,data,length) ^ 0xFFFF;
+}
+
+int ifax_crc16_check(const ifax_uint8 *data, size_t length)
+{
+  return ifax_crc16_update(IFAX_CRC16_INIT,data,length) == IFAX_CRC16_GOOD;
+}
+
+const char *ifax_crc16_engine(void)
+{
+  if ( engine == 0 )
+    setup();
+
+  return engine_name;
+}
@@ -28,12 +28,70 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
+#include <pthread.h>
 
 #include <ifax/ifax.h>
+#include <ifax/modules/generic.h>
+
+#ifdef IFAX_MODULE_STATS
+#include <time.h>
+#endif
 
 static ifax_module_registry    *ifax_modreg_root=NULL;
 static ifax_module_id		ifax_module_lastid=1;
 
+/* All module instances, newest first.  Modules are created and destroyed
+ * by several threads, so the list is only touched with the lock held.
+ */
+static ifax_modp		ifax_module_instances=NULL;
+static pthread_mutex_t		ifax_module_lock=PTHREAD_MUTEX_INITIALIZER;
+
+/* Released buffers are kept here for reuse, one pool per thread.
+ */
+static IFAX_THREAD ifax_buffer	*ifax_buffer_pool=NULL;
+
+#ifdef IFAX_MODULE_STATS
+
+/* Cycles spent in modules called from the current one.
+ */
+static IFAX_THREAD ifax_uint64	ifax_stats_nested=0;
+
+typedef struct {
+	ifax_uint64 start;
+	ifax_uint64 outer;
+} stats_mark;
+
+static ifax_uint64 stats_cycles(void)
+{
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	ifax_uint32 lo, hi;
+
+	__asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+	return ((ifax_uint64)hi<<32) | lo;
+#else
+	return clock();
+#endif
+}
+
+static void stats_enter(stats_mark *mark)
+{
+	mark->outer=ifax_stats_nested;
+	ifax_stats_nested=0;
+	mark->start=stats_cycles();
+}
+
+static void stats_leave(struct ifax_module *self,stats_mark *mark)
+{
+	ifax_uint64 elapsed;
+
+	elapsed=stats_cycles()-mark->start;
+	self->stats.total_cycles+=elapsed;
+	self->stats.self_cycles+=elapsed-ifax_stats_nested;
+	ifax_stats_nested=mark->outer+elapsed;
+}
+
+#endif
+
 /* Register a module class. Returns a module_id (handle) for the newly
  * registered class on success.
  */
@@ -86,6 +144,8 @@ ifax_modp ifax_create_module(ifax_module_id what_kind,...)
 				break;
 			}
 			va_end(list);
+			ifax_module_add_instance(newmodule,
+						 current->module_name);
 			return newmodule;
 		}
 		current=current->next;
@@ -97,7 +157,122 @@ ifax_modp ifax_create_module(ifax_module_id what_kind,...)
  */
 int ifax_handle_input(struct ifax_module *self,void *data,size_t len)
 {
+#ifdef IFAX_MODULE_STATS
+	stats_mark mark;
+	int rc;
+
+	self->stats.input_calls++;
+	self->stats.input_units+=len;
+	stats_enter(&mark);
+	rc=self->handle_input(self,data,len);
+	stats_leave(self,&mark);
+	return rc;
+#else
 	return self->handle_input(self, data,len);
+#endif
+}
+
+/* Send a buffer to a module.  Modules that don't know about buffers
+ * get the contents through their 'handle_input' method, and the buffer
+ * is released on their behalf.
+ */
+int ifax_handle_buffer(struct ifax_module *self,ifax_buffer *buf)
+{
+	int rc;
+#ifdef IFAX_MODULE_STATS
+	stats_mark mark;
+
+	self->stats.input_calls++;
+	self->stats.input_units+=buf->length;
+	stats_enter(&mark);
+#endif
+
+	if (self->handle_buffer) {
+		rc=self->handle_buffer(self,buf);
+	} else {
+		rc=self->handle_input(self,buf->data,buf->length);
+		ifax_buffer_unref(buf);
+	}
+
+#ifdef IFAX_MODULE_STATS
+	stats_leave(self,&mark);
+#endif
+	return rc;
+}
+
+/* Size in bytes of some data in a given format.
+ */
+size_t ifax_buffer_bytes(ifax_format format,size_t length)
+{
+	switch(format) {
+		case IFAX_FORMAT_S16:
+			return length*sizeof(ifax_sint16);
+		case IFAX_FORMAT_BITS:
+			return (length+7)>>3;
+		default:
+			return length;
+	}
+}
+
+/* Get a buffer from the pool, or allocate a new one if the pool is
+ * empty.  The block and its descriptor are allocated in one go.
+ */
+ifax_buffer *ifax_buffer_alloc(ifax_format format,size_t length)
+{
+	ifax_buffer *buf;
+
+	if (ifax_buffer_bytes(format,length)>IFAX_BUFFER_BYTES) {
+		ifax_dprintf(DEBUG_SEVERE,"Buffer of %d units too large\n",
+			(int)length);
+		return NULL;
+	}
+
+	if ((buf=ifax_buffer_pool)!=NULL) {
+		ifax_buffer_pool=buf->next;
+	} else {
+		if (NULL==(buf=malloc(sizeof(ifax_buffer)+IFAX_BUFFER_BYTES)))
+			return NULL;
+		buf->data=buf+1;
+	}
+
+	buf->next=NULL;
+	buf->refcount=1;
+	buf->format=format;
+	buf->length=length;
+
+	return buf;
+}
+
+void ifax_buffer_ref(ifax_buffer *buf)
+{
+	buf->refcount++;
+}
+
+void ifax_buffer_unref(ifax_buffer *buf)
+{
+	if (--buf->refcount>0)
+		return;
+
+	buf->next=ifax_buffer_pool;
+	ifax_buffer_pool=buf;
+}
+
+/* Copy-on-write: a buffer shared with others is duplicated before it
+ * is handed back for modification.
+ */
+ifax_buffer *ifax_buffer_writable(ifax_buffer *buf)
+{
+	ifax_buffer *copy;
+
+	if (buf->refcount==1)
+		return buf;
+
+	if (NULL==(copy=ifax_buffer_alloc(buf->format,buf->length)))
+		return NULL;
+
+	memcpy(copy->data,buf->data,ifax_buffer_bytes(buf->format,buf->length));
+	ifax_buffer_unref(buf);
+	return copy;
 }
 
 /* Request data from a module.  Length is specified by the module,
@@ -105,7 +280,17 @@ int ifax_handle_input(struct ifax_module *self,void *data,size_t len)
  */
 void ifax_handle_demand(struct ifax_module *self, size_t len)
 {
+#ifdef IFAX_MODULE_STATS
+	stats_mark mark;
+
+	self->stats.demand_calls++;
+	self->stats.demand_units+=len;
+	stats_enter(&mark);
+	self->handle_demand(self,len);
+	stats_leave(self,&mark);
+#else
 	self->handle_demand(self,len);
+#endif
 }
 
 /* Send a command to a module. Note, that commands and data are defined 
@@ -117,12 +302,87 @@ int ifax_command(struct ifax_module *self, int command, ...)
 	int rc;
 	
 	va_start(list,command);
-	rc=self->command(self, command, list);
+
+	switch(command) {
+		case CMD_GENERIC_GETSTATS:
+			*va_arg(list,ifax_module_stats *)=self->stats;
+			rc=0;
+			break;
+		case CMD_GENERIC_CLEARSTATS:
+			memset(&self->stats,0,sizeof(self->stats));
+			rc=0;
+			break;
+		default:
+			rc=self->command(self, command, list);
+	}
+
 	va_end(list);
 	
 	return rc;
 }
 
+void ifax_module_add_instance(struct ifax_module *self,const char *name)
+{
+	self->name=name;
+	pthread_mutex_lock(&ifax_module_lock);
+	self->next_instance=ifax_module_instances;
+	ifax_module_instances=self;
+	pthread_mutex_unlock(&ifax_module_lock);
+}
+
+/* Destroy a module instance and free it.  It is taken off the list of
+ * instances first, so the statistics never look at a freed module.
+ */
+void ifax_destroy_module(struct ifax_module *self)
+{
+	ifax_modp *walk;
+
+	pthread_mutex_lock(&ifax_module_lock);
+	for (walk=&ifax_module_instances; *walk!=NULL;
+	     walk=&(*walk)->next_instance) {
+		if (*walk==self) {
+			*walk=self->next_instance;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&ifax_module_lock);
+
+	if (self->destroy)
+		self->destroy(self);
+	free(self);
+}
+
+/* Print the statistics for all modules.  The cycle counts are printed
+ * in thousands, to keep the columns reasonably narrow.  The counters of
+ * modules run by other threads may be a little behind, but the modules
+ * can't go away while the list is locked.
+ */
+void ifax_module_stats_dump(void)
+{
+#ifdef IFAX_MODULE_STATS
+	ifax_modp mod;
+	ifax_module_stats *st;
+
+	ifax_dprintf(DEBUG_LAST,"%-24s %10s %12s %10s %12s %12s %12s\n",
+		"Module","Inputs","Units in","Demands","Units req",
+		"kCycles","kCycles self");
+
+	pthread_mutex_lock(&ifax_module_lock);
+	for (mod=ifax_module_instances; mod!=NULL; mod=mod->next_instance) {
+		st=&mod->stats;
+		ifax_dprintf(DEBUG_LAST,"%-24.24s %10lu %12lu %10lu %12lu "
+			"%12lu %12lu\n", mod->name ? mod->name : "?",
+			st->input_calls,(unsigned long)st->input_units,
+			st->demand_calls,(unsigned long)st->demand_units,
+			(unsigned long)(st->total_cycles/1000),
+			(unsigned long)(st->self_cycles/1000));
+	}
+	pthread_mutex_unlock(&ifax_module_lock);
+#else
+	ifax_dprintf(DEBUG_LAST,"Module statistics not compiled in\n");
+#endif
+}
+
 /* Make a connection in a chain of signal-processing modules and update
  * both forward and backward pointers.  The direction of the flow of data
  * is from the source module to the destination module.
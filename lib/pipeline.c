@@ -0,0 +1,290 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Compiled pipelines of modules.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+/* The pipeline runs the stages on one block of input at a time.  The
+ * block size is chosen when the pipeline is compiled, as the largest
+ * power of two where the output of every stage fits in the working
+ * buffers, and the output of the last stage fits in a pooled buffer.
+ * The working buffers are used in turn, so the data of a block is kept
+ * in the same few kilobytes of memory all the way through.
+ */
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include <ifax/ifax.h>
+
+typedef struct {
+
+  int stages;
+  ifax_modp stage[IFAX_PIPELINE_MAXSTAGES];
+  ifax_format input_format, output_format;
+  size_t block;			/* Input units processed per round */
+  size_t outmax;		/* Most output units from one round */
+  ifax_modp linked_from;	/* The neighbours at the last relink */
+  ifax_modp linked_to;
+
+  union {
+    ifax_sint16 samples[IFAX_PIPELINE_WORKBYTES/sizeof(ifax_sint16)];
+    ifax_uint8 bytes[IFAX_PIPELINE_WORKBYTES];
+  } work[2];
+
+} pipeline_private;
+
+
+/* Number of units of a format that fits in 'bytes' bytes */
+
+static size_t capacity(ifax_format format, size_t bytes)
+{
+  switch ( format ) {
+    case IFAX_FORMAT_S16:
+      return bytes / sizeof(ifax_sint16);
+    case IFAX_FORMAT_BITS:
+      return bytes * 8;
+    default:
+      return bytes;
+  }
+}
+
+/* The stages are kept connected to each other, and the first and last
+ * stage to whatever the pipeline is connected to.  The stages belong to
+ * the pipeline, so this only needs doing again when the pipeline itself
+ * has been connected to something else.
+ */
+
+static void relink(ifax_modp self)
+{
+  pipeline_private *priv = self->private;
+  int s;
+
+  priv->stage[0]->recvfrom = self->recvfrom;
+  for ( s=1; s < priv->stages; s++ )
+    ifax_connect(priv->stage[s-1],priv->stage[s]);
+  priv->stage[priv->stages-1]->sendto = self->sendto;
+
+  priv->linked_from = self->recvfrom;
+  priv->linked_to = self->sendto;
+}
+
+static int pipeline_handle(ifax_modp self, void *data, size_t length)
+{
+  pipeline_private *priv = self->private;
+  size_t chunk, n, remaining = length;
+  ifax_uint8 *src = data;
+  ifax_buffer *buf;
+  ifax_modp stage;
+  void *in, *out;
+  int s;
+
+  while ( remaining > 0 ) {
+
+    chunk = remaining;
+    if ( chunk > priv->block )
+      chunk = priv->block;
+
+    if ( (buf = ifax_buffer_alloc(priv->output_format,priv->outmax)) == 0 )
+      return length - remaining;
+
+    in = src;
+    n = chunk;
+    for ( s=0; s < priv->stages && n > 0; s++ ) {
+      stage = priv->stage[s];
+      out = s == priv->stages-1 ? buf->data : priv->work[s&1].bytes;
+      n = stage->process(stage,in,n,out);
+      in = out;
+    }
+
+    if ( n > 0 ) {
+      buf->length = n;
+      ifax_handle_buffer(self->sendto,buf);
+    } else {
+      ifax_buffer_unref(buf);
+    }
+
+    src += ifax_buffer_bytes(priv->input_format,chunk);
+    remaining -= chunk;
+  }
+
+  return length;
+}
+
+static int pipeline_handle_buffer(ifax_modp self, ifax_buffer *buf)
+{
+  int rc;
+
+  rc = pipeline_handle(self,buf->data,buf->length);
+  ifax_buffer_unref(buf);
+
+  return rc;
+}
+
+static void pipeline_demand(ifax_modp self, size_t demand)
+{
+  pipeline_private *priv = self->private;
+
+  if ( self->recvfrom != priv->linked_from
+       || self->sendto != priv->linked_to )
+    relink(self);
+
+  if ( self->recvfrom != 0 )
+    ifax_handle_demand(priv->stage[priv->stages-1],demand);
+}
+
+static int pipeline_command(ifax_modp self, int cmd, va_list cmds)
+{
+  return 1;
+}
+
+/* The stages are given back to the chain when the pipeline goes away */
+
+static void pipeline_destroy(ifax_modp self)
+{
+  pipeline_private *priv = self->private;
+  ifax_modp prev = self->recvfrom, next = self->sendto;
+
+  relink(self);
+  if ( prev != 0 && prev->sendto == self )
+    prev->sendto = priv->stage[0];
+  if ( next != 0 && next->recvfrom == self )
+    next->recvfrom = priv->stage[priv->stages-1];
+
+  free(self->private);
+}
+
+/* Find the largest block of input that can be processed in one go.
+ * Returns 0 if not even the smallest block fits.
+ */
+
+static size_t find_blocksize(pipeline_private *priv)
+{
+  size_t block, n, room;
+  ifax_modp stage;
+  int s;
+
+  block = capacity(priv->input_format,IFAX_PIPELINE_WORKBYTES);
+
+  for ( ; block >= 8; block >>= 1 ) {
+    n = block;
+    for ( s=0; s < priv->stages; s++ ) {
+      stage = priv->stage[s];
+      n = stage->process_max(stage,n);
+      if ( s == priv->stages-1 )
+	room = capacity(stage->output_format,IFAX_BUFFER_BYTES);
+      else
+	room = capacity(stage->output_format,IFAX_PIPELINE_WORKBYTES);
+      if ( n > room )
+	break;
+    }
+    if ( s == priv->stages ) {
+      priv->outmax = n;
+      return block;
+    }
+  }
+
+  return 0;
+}
+
+ifax_modp ifax_pipeline_compile(ifax_modp first, ifax_modp last)
+{
+  pipeline_private *priv;
+  ifax_modp self, mod;
+  int s;
+
+  if ( (priv = malloc(sizeof(pipeline_private))) == 0 )
+    return 0;
+
+  /* Collect and check the stages */
+
+  s = 0;
+  for ( mod=first; mod != 0; mod = mod->sendto ) {
+    if ( s >= IFAX_PIPELINE_MAXSTAGES ) {
+      ifax_dprintf(DEBUG_SEVERE,"Pipeline: Too many stages\n");
+      goto fail;
+    }
+    if ( mod->process == 0 || mod->process_max == 0 ) {
+      ifax_dprintf(DEBUG_SEVERE,"Pipeline: Stage %d can't be compiled\n",s);
+      goto fail;
+    }
+    if ( mod->input_format == IFAX_FORMAT_UNKNOWN
+	 || mod->output_format == IFAX_FORMAT_UNKNOWN
+	 || (s > 0 && priv->stage[s-1]->output_format != mod->input_format) ) {
+      ifax_dprintf(DEBUG_SEVERE,"Pipeline: Format mismatch at stage %d\n",s);
+      goto fail;
+    }
+    priv->stage[s++] = mod;
+    if ( mod == last )
+      break;
+  }
+
+  if ( mod == 0 ) {
+    ifax_dprintf(DEBUG_SEVERE,"Pipeline: Last stage not in chain\n");
+    goto fail;
+  }
+
+  priv->stages = s;
+  priv->input_format = first->input_format;
+  priv->output_format = last->output_format;
+
+  if ( last->sendto != 0
+       && last->sendto->input_format != IFAX_FORMAT_UNKNOWN
+       && last->sendto->input_format != priv->output_format ) {
+    ifax_dprintf(DEBUG_SEVERE,"Pipeline: Output format mismatch\n");
+    goto fail;
+  }
+
+  if ( (priv->block = find_blocksize(priv)) == 0 ) {
+    ifax_dprintf(DEBUG_SEVERE,"Pipeline: Stages produce too much output\n");
+    goto fail;
+  }
+
+  if ( (self = malloc(sizeof(ifax_module))) == 0 )
+    goto fail;
+  memset(self,0,sizeof(ifax_module));
+
+  self->private = priv;
+  self->destroy = pipeline_destroy;
+  self->handle_input = pipeline_handle;
+  self->handle_buffer = pipeline_handle_buffer;
+  self->handle_demand = pipeline_demand;
+  self->command = pipeline_command;
+  self->input_format = priv->input_format;
+  self->output_format = priv->output_format;
+
+  ifax_module_add_instance(self,"Compiled pipeline");
+
+  /* Take the place of the stages in the chain */
+
+  ifax_connect(first->recvfrom,self);
+  ifax_connect(self,last->sendto);
+  relink(self);
+
+  return self;
+
+ fail:
+  free(priv);
+  return 0;
+}
@@ -5,8 +5,7 @@
 
    Copyright (C) 1999 Oliver Eichler [oliver.eichler@regensburg.netsurf.de
 
-   This function calculates the angle of a complex number x = real, y = imag.
-   The angle is represented as: 0..360 -> 0x0000..0xFFFFF
+   This function calculates the square root of a positive Q15 number.
 
 
    Permission is hereby granted, free of charge, to any person obtaining a
@@ -29,59 +28,29 @@
    ******************************************************************************
  */
 
-#undef CALC_TBL
-
+/* The square root is taken in floating point, which is exact enough
+ * to round down to the same values as the old 64 KB table held.
+ */
 
-#ifdef CALC_TBL
 #include <math.h>
-#include <stdio.h>
-#include <stdlib.h>
-#else
-   extern short sqrttbl[];
-#endif
+
+#include <ifax/types.h>
+#include <ifax/sqrt.h>
+
+/* sqrt(x/32768) * 32768, or 0xFFFF for negative x */
 
    unsigned short intsqrt (short x)
    {
-      short res;
-      if(x>=0){
-         res = sqrttbl[x];	
-      }
-      else{
-         res = (short)0x0FFFF;
-      }
-      return res;
+      if (x < 0)
+         return 0xFFFF;
+   
+      return (unsigned short) sqrt ((double)x * 32768.0);
    }
 
-
-
-#ifdef CALC_TBL
-   void
-   gen_sqrt_tbl (void)
+   void intsqrt_block (const short *x, unsigned short *res, int n)
    {
-      float x;
-      short y;
-      FILE *fid;
-      int n, i;
-   
-      fid = fopen ("sqrttbl.c", "wt");
-      fprintf (fid, "short sqrttbl[] = \n");
-      fprintf (fid, "{\n");
-   
-      n = 8;
-      for (i = 0; i < 32767; i++)
-      {
-         x = (float) i / 32768;
-         y = (short) (sqrt(x) * 32768);
-         fprintf (fid, "0x%04X, ", y & 0x0000FFFF);
-         n--;
-         if (!n)
-         {
-            fprintf (fid, "\n");
-            n = 8;
-         }
-      }
+      int i;
    
-      fprintf (fid, "};\n\n");
-      fclose (fid);
+      for (i = 0; i < n; i++)
+         res[i] = intsqrt (x[i]);
    }
-#endif
@@ -0,0 +1,228 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Real-time thread for the signal processing.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/eventfd.h>
+
+#include <ifax/debug.h>
+#include <ifax/misc/dspthread.h>
+#include <ifax/misc/globals.h>
+#include <ifax/misc/malloc.h>
+
+/* Room for this many calls in each direction */
+#define DSP_CALLS	256
+
+struct dsp_call {
+	dsp_function function;
+	void *arg;
+};
+
+
+static int send_call(struct IORing *ring, int fd, dsp_function function,
+		     void *arg)
+{
+	struct dsp_call call;
+	ifax_uint64 one = 1;
+
+	call.function = function;
+	call.arg = arg;
+
+	if ( ioring_fill(ring,&call,sizeof(call)) != sizeof(call) ) {
+		ifax_dprintf(DEBUG_ERROR,"%s: Ring %s is full\n",
+			     progname,ring->descr);
+		return 1;
+	}
+
+	/* A full counter means the other end is awake already */
+	write(fd,&one,sizeof(one));
+
+	return 0;
+}
+
+/* The eventfd is reset before the calls are run, so a call arriving
+ * after the last one was taken out will make it ready again.
+ */
+
+static void run_calls(struct IORing *ring, int fd)
+{
+	struct dsp_call call;
+	ifax_uint64 count;
+
+	read(fd,&count,sizeof(count));
+
+	while ( ioring_drain(ring,&call,sizeof(call)) == sizeof(call) )
+		call.function(call.arg);
+}
+
+static void wakeup_handler(void *context, int events)
+{
+	struct DSPThread *dsp = context;
+
+	run_calls(dsp->calls,dsp->wakeup.fd);
+}
+
+static void notify_handler(void *context, int events)
+{
+	struct DSPThread *dsp = context;
+
+	run_calls(dsp->replies,dsp->notify.fd);
+}
+
+int dsp_call(struct DSPThread *dsp, dsp_function function, void *arg)
+{
+	return send_call(dsp->calls,dsp->wakeup.fd,function,arg);
+}
+
+int dsp_reply(struct DSPThread *dsp, dsp_function function, void *arg)
+{
+	return send_call(dsp->replies,dsp->notify.fd,function,arg);
+}
+
+
+/* The ticks are kept on a fixed schedule, so they don't drift.  If the
+ * thread falls more than a tick behind (which it shouldn't), the lost
+ * ticks are skipped rather than run back to back.
+ */
+
+static void advance_tick(struct DSPThread *dsp, struct timeval *now)
+{
+	struct timeval *t = &dsp->next_tick;
+
+	t->tv_usec += DSP_TICK * 1000;
+	if ( t->tv_usec >= 1000000 ) {
+		t->tv_sec++;
+		t->tv_usec -= 1000000;
+	}
+
+	if ( now->tv_sec > t->tv_sec
+	     || (now->tv_sec == t->tv_sec && now->tv_usec > t->tv_usec) ) {
+		ifax_dprintf(DEBUG_ERROR,"%s: DSP thread overrun\n",progname);
+		*t = *now;
+	}
+}
+
+static int tick_due(struct DSPThread *dsp, struct timeval *now)
+{
+	struct timeval *t = &dsp->next_tick;
+
+	return now->tv_sec > t->tv_sec
+		|| (now->tv_sec == t->tv_sec && now->tv_usec >= t->tv_usec);
+}
+
+static void *dsp_main(void *arg)
+{
+	struct DSPThread *dsp = arg;
+	struct timeval now;
+
+	eventloop_current = dsp->el;
+	gettimeofday(&dsp->next_tick,(struct timezone *)0);
+
+	for (;;) {
+		eventloop_deadline(dsp->el,&dsp->next_tick);
+		eventloop_wait(dsp->el,dsp->hurry ? 0 : -1);
+		gettimeofday(&now,(struct timezone *)0);
+
+		if ( tick_due(dsp,&now) ) {
+			dsp->hurry = 0;
+			dsp->early = 0;
+			dsp->tick(dsp->tick_arg);
+			advance_tick(dsp,&now);
+		} else if ( dsp->hurry ) {
+			dsp->hurry = 0;
+			dsp->early = 1;
+			dsp->tick(dsp->tick_arg);
+		}
+	}
+
+	return 0;
+}
+
+
+struct DSPThread *dsp_start(struct EventLoop *control,
+			    dsp_function tick, void *tick_arg, int priority)
+{
+	struct DSPThread *dsp;
+	struct sched_param schedparams;
+	pthread_attr_t attr;
+	int rc;
+
+	dsp = ifax_malloc(sizeof(*dsp),"DSP thread");
+	dsp->el = eventloop_create();
+	dsp->calls = ioring_allocate(DSP_CALLS*sizeof(struct dsp_call),
+				     "DSP/calls");
+	dsp->replies = ioring_allocate(DSP_CALLS*sizeof(struct dsp_call),
+				       "DSP/replies");
+	dsp->tick = tick;
+	dsp->tick_arg = tick_arg;
+
+	if ( (dsp->wakeup.fd=eventfd(0,EFD_NONBLOCK)) < 0
+	     || (dsp->notify.fd=eventfd(0,EFD_NONBLOCK)) < 0 ) {
+		ifax_dprintf(DEBUG_LAST,"%s: Unable to create eventfd: %s\n",
+			     progname,strerror(errno));
+		exit(1);
+	}
+
+	dsp->wakeup.handler = wakeup_handler;
+	dsp->wakeup.context = dsp;
+	eventloop_add(dsp->el,&dsp->wakeup);
+
+	dsp->notify.handler = notify_handler;
+	dsp->notify.context = dsp;
+	eventloop_add(control,&dsp->notify);
+
+	/* The DSP thread gets its own real-time priority, if any */
+
+	pthread_attr_init(&attr);
+	if ( priority > 0 ) {
+		schedparams.sched_priority = priority;
+		pthread_attr_setinheritsched(&attr,PTHREAD_EXPLICIT_SCHED);
+		pthread_attr_setschedpolicy(&attr,SCHED_FIFO);
+		pthread_attr_setschedparam(&attr,&schedparams);
+	}
+
+	rc = pthread_create(&dsp->thread,&attr,dsp_main,dsp);
+	if ( rc == EPERM ) {
+		fprintf(stderr,"%s: Couldn't enable real-time scheduling "
+			"for DSP thread\n",progname);
+		rc = pthread_create(&dsp->thread,0,dsp_main,dsp);
+	}
+	pthread_attr_destroy(&attr);
+
+	if ( rc != 0 ) {
+		ifax_dprintf(DEBUG_LAST,"%s: Unable to start DSP thread\n",
+			     progname);
+		exit(1);
+	}
+
+	return dsp;
+}
@@ -0,0 +1,167 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Event loop waiting for file descriptors and deadlines.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+/* The event loop is built on epoll, so the cost of waiting does not
+ * depend on the number of file descriptors registered, only on the
+ * number of them that are ready.  Deadlines are handled by a timerfd
+ * registered along with the other descriptors; it is set to the
+ * earliest deadline asked for since it last expired.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+
+#include <ifax/debug.h>
+#include <ifax/misc/eventloop.h>
+#include <ifax/misc/globals.h>
+#include <ifax/misc/malloc.h>
+
+#define MAXEVENTS	64
+
+struct EventLoop {
+	int epfd;
+	struct EventSource timer;
+	struct timeval deadline;	/* tv_sec == 0 when none */
+	int expired;
+};
+
+IFAX_THREAD struct EventLoop *eventloop_current = 0;
+
+
+static void timer_expired(void *context, int events)
+{
+	struct EventLoop *el = context;
+	ifax_uint64 count;
+
+	if ( read(el->timer.fd,&count,sizeof(count)) < 0 )
+		return;
+
+	el->deadline.tv_sec = 0;
+	el->expired = 1;
+}
+
+static void failed(char *what)
+{
+	ifax_dprintf(DEBUG_LAST,"%s: Event loop %s failed: %s\n",
+		     progname,what,strerror(errno));
+	exit(1);
+}
+
+struct EventLoop *eventloop_create(void)
+{
+	struct EventLoop *el;
+
+	el = ifax_malloc(sizeof(*el),"Event loop");
+
+	if ( (el->epfd=epoll_create(MAXEVENTS)) < 0 )
+		failed("epoll_create");
+
+	if ( (el->timer.fd=timerfd_create(CLOCK_REALTIME,TFD_NONBLOCK)) < 0 )
+		failed("timerfd_create");
+
+	el->timer.handler = timer_expired;
+	el->timer.context = el;
+	eventloop_add(el,&el->timer);
+
+	return el;
+}
+
+void eventloop_add(struct EventLoop *el, struct EventSource *src)
+{
+	struct epoll_event ev;
+
+	ev.events = EPOLLIN | EPOLLOUT | EPOLLET;
+	ev.data.ptr = src;
+
+	if ( epoll_ctl(el->epfd,EPOLL_CTL_ADD,src->fd,&ev) < 0 )
+		failed("epoll_ctl");
+}
+
+void eventloop_remove(struct EventLoop *el, struct EventSource *src)
+{
+	struct epoll_event ev;
+
+	/* Closing the file descriptor removes it too, so no complaints */
+	epoll_ctl(el->epfd,EPOLL_CTL_DEL,src->fd,&ev);
+}
+
+void eventloop_deadline(struct EventLoop *el, struct timeval *when)
+{
+	struct itimerspec its;
+
+	if ( el->deadline.tv_sec != 0 ) {
+		if ( when->tv_sec > el->deadline.tv_sec )
+			return;
+		if ( when->tv_sec == el->deadline.tv_sec
+		     && when->tv_usec >= el->deadline.tv_usec )
+			return;
+	}
+
+	el->deadline = *when;
+
+	memset(&its,0,sizeof(its));
+	its.it_value.tv_sec = when->tv_sec;
+	its.it_value.tv_nsec = when->tv_usec * 1000;
+
+	if ( timerfd_settime(el->timer.fd,TFD_TIMER_ABSTIME,&its,0) < 0 )
+		failed("timerfd_settime");
+}
+
+int eventloop_wait(struct EventLoop *el, int timeout)
+{
+	struct epoll_event events[MAXEVENTS];
+	struct EventSource *src;
+	int n, t, ev;
+
+	el->expired = 0;
+
+	if ( (n=epoll_wait(el->epfd,events,MAXEVENTS,timeout)) < 0 ) {
+		if ( errno == EINTR )
+			return 0;
+		failed("epoll_wait");
+	}
+
+	for ( t=0; t < n; t++ ) {
+		src = events[t].data.ptr;
+		ev = 0;
+		if ( events[t].events & EPOLLIN )
+			ev |= EVENT_READ;
+		if ( events[t].events & EPOLLOUT )
+			ev |= EVENT_WRITE;
+		if ( events[t].events & (EPOLLERR|EPOLLHUP) )
+			ev |= EVENT_ERROR;
+		src->handler(src->context,ev);
+	}
+
+	return el->expired || (n == 0 && timeout > 0);
+}
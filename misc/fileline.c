@@ -0,0 +1,253 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Hardware driver replaying recorded calls from files
+  
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+/* This hardware driver takes the place of a phone line when testing or
+ * measuring the signal processing.  A call recorded from a /dev/ttyI*
+ * device (bit-reversed A-law, with DLE doubled) is read from a file and
+ * given to the signal chain as received samples, and the transmitted
+ * samples are written to another file in the same format.  The call
+ * goes online as soon as the driver is initialized and ends with the
+ * input file (or a DLE ETX in it).
+ *
+ * The replay is not tied to the clock; the DSP thread is asked to come
+ * back right away as long as there is more input, so the samples are
+ * run through as fast as the CPU can manage.  Those early ticks only
+ * service the lines that asked for them, so other lines on the same
+ * DSP thread stay in real time.
+ *
+ * Configuration:
+ *
+ *	hardware = file
+ *	file-input = call.alaw
+ *	file-output = reply.alaw	(optional)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/time.h>
+
+#include <ifax/ifax.h>
+#include <ifax/alaw.h>
+#include <ifax/misc/fileline.h>
+#include <ifax/misc/isdnline.h>
+#include <ifax/misc/malloc.h>
+#include <ifax/misc/hardware-driver.h>
+
+#define DLE	0x10
+#define ETX	0x03
+
+
+static void file_configure(struct HardwareHandle *hh, char *param, char *value)
+{
+	struct FileHandle *fh = hh->private;
+
+	if ( strlen(value) >= FILENAME_SIZE ) {
+		hh->error = 1;
+		sprintf(hh->errormsg,"file-%s is too long",param);
+		return;
+	}
+
+	if ( !strcmp(param,"input") ) {
+		strcpy(fh->input,value);
+		return;
+	}
+
+	if ( !strcmp(param,"output") ) {
+		strcpy(fh->output,value);
+		return;
+	}
+
+	hh->error = 1;
+	sprintf(hh->errormsg,"Unrecognized configuration option '%s'",param);
+}
+
+static void file_initialize(struct HardwareHandle *hh)
+{
+	struct FileHandle *fh = hh->private;
+
+	if ( (fh->in=fopen(fh->input,"r")) == 0 ) {
+		hh->error = 1;
+		sprintf(hh->errormsg,"Can't open '%.64s': %s",fh->input,
+			strerror(errno));
+		return;
+	}
+
+	if ( fh->output[0] != '\0' && (fh->out=fopen(fh->output,"w")) == 0 ) {
+		hh->error = 1;
+		sprintf(hh->errormsg,"Can't create '%.64s': %s",fh->output,
+			strerror(errno));
+		fclose(fh->in);
+		fh->in = 0;
+		return;
+	}
+
+	gettimeofday(&fh->start,(struct timezone *)0);
+	hh->state = ONLINE;
+}
+
+/* The call is over when the input is; tell how fast it went */
+
+static void file_hangup(struct HardwareHandle *hh)
+{
+	struct FileHandle *fh = hh->private;
+	struct timeval now;
+	double elapsed;
+
+	if ( hh->state != ONLINE )
+		return;
+
+	gettimeofday(&now,(struct timezone *)0);
+	elapsed = (now.tv_sec - fh->start.tv_sec)
+		+ (now.tv_usec - fh->start.tv_usec) / 1000000.0;
+
+	ifax_dprintf(DEBUG_INFO,"%s: %ld samples in %.3f s (%.0f x real time)\n",
+		     fh->input,fh->samples,elapsed,
+		     elapsed > 0 ? fh->samples / 8000.0 / elapsed : 0.0);
+
+	fclose(fh->in);
+	fh->in = 0;
+	if ( fh->out != 0 ) {
+		fclose(fh->out);
+		fh->out = 0;
+	}
+
+	hh->state = IDLE;
+	hh->pending = 0;
+}
+
+/* Each service hands out a new budget of samples to the signal chain */
+
+static void file_service_select(struct HardwareHandle *hh, fd_set *rfd,
+				fd_set *wfd, fd_set *efd)
+{
+	struct FileHandle *fh = hh->private;
+
+	if ( hh->state != ONLINE )
+		return;
+
+	fh->budget = FILE_SAMPLES_PER_SERVICE;
+	hh->pending = 1;
+}
+
+static void file_prepare_select(struct HardwareHandle *hh, int *maxfd,
+				fd_set *rfd, fd_set *wfd, fd_set *efd)
+{
+}
+
+static void file_attach(struct HardwareHandle *hh, struct EventLoop *el,
+			event_handler handler, void *context)
+{
+}
+
+static int file_read_samples(struct HardwareHandle *hh,
+			     ifax_sint16 *dst, int cnt)
+{
+	struct FileHandle *fh = hh->private;
+	ifax_uint8 c;
+	int n = 0, over = 0;
+
+	if ( hh->state != ONLINE )
+		return 0;
+
+	if ( cnt > fh->budget )
+		cnt = fh->budget;
+
+	while ( n < cnt ) {
+
+		if ( fh->rp >= fh->size ) {
+			fh->size = fread(fh->rbuf,1,FILEREAD_SIZE,fh->in);
+			fh->rp = 0;
+			if ( fh->size <= 0 ) {
+				over = 1;
+				break;
+			}
+		}
+
+		c = fh->rbuf[fh->rp++];
+
+		if ( fh->have_dle ) {
+			fh->have_dle = 0;
+			if ( c == ETX ) {
+				over = 1;
+				break;
+			}
+			if ( c != DLE )
+				continue;	/* Other DLE codes ignored */
+		} else if ( c == DLE ) {
+			fh->have_dle = 1;
+			continue;
+		}
+
+		dst[n++] = 8 * wala2sint[c];
+	}
+
+	fh->budget -= n;
+	fh->samples += n;
+
+	if ( over )
+		file_hangup(hh);
+
+	return n;
+}
+
+/* Same conversion as for the ISDN device, see 'isdn_write_samples' */
+
+static void file_write_samples(struct HardwareHandle *hh,
+			       ifax_sint16 *src, int cnt)
+{
+	struct FileHandle *fh = hh->private;
+	int chunk, bytes;
+
+	while ( cnt > 0 ) {
+
+		chunk = cnt > FILEREAD_SIZE ? FILEREAD_SIZE : cnt;
+		bytes = isdn_encode_samples(src,&fh->wbuf[0],chunk);
+		src += chunk;
+		cnt -= chunk;
+
+		if ( fh->out != 0 )
+			fwrite(fh->wbuf,1,bytes,fh->out);
+	}
+}
+
+void file_allocate(struct HardwareHandle *hh)
+{
+	struct FileHandle *fh;
+
+	fh = ifax_malloc(sizeof(*fh),"File hardware driver handle");
+	hh->private = fh;
+
+	hh->configure = file_configure;
+	hh->initialize = file_initialize;
+
+	hh->prepare_select = file_prepare_select;
+	hh->service_select = file_service_select;
+	hh->attach = file_attach;
+	hh->read = file_read_samples;
+	hh->write = file_write_samples;
+	hh->hangup = file_hangup;
+}
@@ -32,5 +32,5 @@
 
 char *progname = "amodemd";
 int run_as_daemon = 0;
-ifax_modp linedriver;
-struct HardwareHandle *hh = 0;
+struct ModemLine *lines = 0;
+int num_lines = 0;
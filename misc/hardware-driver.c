@@ -67,6 +67,8 @@
 
 #include <ifax/misc/malloc.h>
 #include <ifax/misc/isdnline.h>
+#include <ifax/misc/fileline.h>
+#include <ifax/misc/loopline.h>
 #include <ifax/misc/hardware-driver.h>
 
 
@@ -87,6 +89,20 @@ struct HardwareHandle *hardware_allocate(char *hwclass)
 		return hh;
 	}
 
+	if ( !strcmp(hwclass,"file") ) {
+		/* Recorded calls, for testing and measurements */
+		hh->type = AUDIOFILE;
+		file_allocate(hh);
+		return hh;
+	}
+
+	if ( !strcmp(hwclass,"loopback") ) {
+		/* Two lines calling each other, for testing */
+		hh->type = LOOPBACK;
+		loopback_allocate(hh);
+		return hh;
+	}
+
 	/* Check for more supported hardware here */
 
 	free(hh);		/* Failed, no such hardware supported */
@@ -39,12 +39,27 @@
  *
  *     struct IOBuffer *iob = iobuffer_allocate(int size);
  *     ....
+ *
+ * A buffer made by 'iobuffer_allocate_mirrored' has its data mapped
+ * twice in a row in memory, so the byte after the last one is the
+ * first one again.  The data and the free space are then always one
+ * contiguous span, even when they wrap around the end of the ring,
+ * and can be worked on in place.
+ *
+ * 'iobuffer_read' and 'iobuffer_write' move as much as they can with
+ * one system call, using both segments of the ring when the data or the
+ * free space wraps around.  The calls made and bytes moved are counted
+ * in the 'stats' of the buffer, and reported by 'iobuffer_stats_dump'.
  */
 
+#define _GNU_SOURCE
+
 #include <errno.h>
 #include <string.h>
 #include <unistd.h>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
 #include <ifax/misc/iobuffer.h>
 #include <ifax/debug.h>
 
@@ -58,6 +73,79 @@ struct IOBuffer *iobuffer_allocate(int size, char *devinfo)
 	iob->total = size;
 	iobuffer_reset(iob);
 	strcpy(iob->descr,devinfo);
+	gettimeofday(&iob->stats.since,0);
+	iob->reported = iob->stats;
+
+	iob->debug = FILLUPDATE | WRITE;
+
+	return iob;
+}
+
+/* Map 'size' bytes of memory twice, back to back.  Returns NULL if the
+ * system can't do it.
+ */
+
+static ifax_uint8 *map_mirrored(int size)
+{
+	ifax_uint8 *base;
+	int fd;
+
+	if ( (fd = memfd_create("iobuffer",0)) < 0 )
+		return 0;
+
+	if ( ftruncate(fd,size) < 0 ) {
+		close(fd);
+		return 0;
+	}
+
+	/* Reserve room for both, then put the two views in place */
+	base = mmap(0,2*size,PROT_NONE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+	if ( base == MAP_FAILED ) {
+		close(fd);
+		return 0;
+	}
+
+	if ( mmap(base,size,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_FIXED,
+		  fd,0) == MAP_FAILED
+	     || mmap(base+size,size,PROT_READ|PROT_WRITE,MAP_SHARED|MAP_FIXED,
+		     fd,0) == MAP_FAILED ) {
+		munmap(base,2*size);
+		close(fd);
+		return 0;
+	}
+
+	close(fd);		/* The mappings keep the memory */
+	return base;
+}
+
+/* The size is rounded up to whole pages.  If the data can't be mapped
+ * twice, an ordinary buffer is made, so callers must still be prepared
+ * to see two segments.
+ */
+
+struct IOBuffer *iobuffer_allocate_mirrored(int size, char *devinfo)
+{
+	struct IOBuffer *iob;
+	ifax_uint8 *data;
+	int page;
+
+	page = sysconf(_SC_PAGESIZE);
+	size = (size + page - 1) / page * page;
+
+	if ( (data = map_mirrored(size)) == 0 ) {
+		ifax_dprintf(DEBUG_INFO,"%s: Can't mirror buffer: %s\n",
+			     devinfo,strerror(errno));
+		return iobuffer_allocate(size,devinfo);
+	}
+
+	iob = ifax_malloc(sizeof(*iob),"IOBuffer instance");
+	iob->data = data;
+	iob->mirrored = 1;
+	iob->total = size;
+	iobuffer_reset(iob);
+	strcpy(iob->descr,devinfo);
+	gettimeofday(&iob->stats.since,0);
+	iob->reported = iob->stats;
 
 	iob->debug = FILLUPDATE | WRITE;
 
@@ -74,11 +162,12 @@ void iobuffer_reset(struct IOBuffer *iob)
  * right and good looking.  The debug_buffer holds the current line
  * of debugging output, while the previous_prefix holds the prefix of
  * the current debug buffer, so the buffer can be flushed when a
- * different prefix is specified.
+ * different prefix is specified.  Every thread has its own set, so
+ * the lines served by different threads don't mix their output.
  */
-static char debug_buffer[128];
-static char previous_prefix[64] = { '\0', };
-static int debug_idx, debug_any = 0;
+static IFAX_THREAD char debug_buffer[128];
+static IFAX_THREAD char previous_prefix[64] = { '\0', };
+static IFAX_THREAD int debug_idx, debug_any = 0;
 
 static void iodump_flush(void)
 {
@@ -149,6 +238,11 @@ void iobuffer_fill_segment(struct IOBuffer *iob, ifax_uint8 **dst, int *len)
 
 	*dst = &iob->data[iob->fp];
 
+	if ( iob->mirrored ) {
+		*len = iob->total - iob->size;
+		return;
+	}
+
 	if ( iob->fp < iob->dp ) {
 		*len = iob->dp - iob->fp;
 		return;
@@ -157,6 +251,10 @@ void iobuffer_fill_segment(struct IOBuffer *iob, ifax_uint8 **dst, int *len)
 	*len = iob->total - iob->fp;
 }
 
+/* The data filled in is always within the segment given by
+ * 'iobuffer_fill_segment', so it is contiguous in memory.
+ */
+
 void iobuffer_fill_update(struct IOBuffer *iob, int size, char *info)
 {
 	char prefix[128];
@@ -164,23 +262,14 @@ void iobuffer_fill_update(struct IOBuffer *iob, int size, char *info)
 	if ( info != 0 ) {
 		strcpy(prefix,iob->descr);
 		strcat(prefix,info);
+		iodump(prefix,&iob->data[iob->fp],size);
 	}
 
-	if ( iob->fp < iob->total ) {
-		/* Didn't wrap around */
-		if ( info != 0 )
-			iodump(prefix,&iob->data[iob->fp],size);
-		iob->fp += size;
-		iob->size += size;
-	} else {
-		/* Did wrap, split logging in two */
-		if ( info != 0 ) {
-			iodump(prefix,&iob->data[iob->fp],iob->total-iob->fp);
-			iob->fp = iob->fp + size - iob->total;
-			iob->size += size;
-			iodump(prefix,&iob->data[0],iob->fp);
-		}
-	}
+	iob->fp += size;
+	if ( iob->fp >= iob->total )
+		iob->fp -= iob->total;
+	iob->size += size;
+	iob->filled += size;
 
 	iodump_flush();
 }
@@ -219,11 +308,11 @@ void iobuffer_drain_segments(struct IOBuffer *iob,
 		return;
 	}
 	
-	if ( iob->dp < iob->fp ) {
+	if ( iob->dp < iob->fp || iob->mirrored ) {
 		/* One continous segment */
 		*src1 = &iob->data[iob->dp];
-		*len1 = iob->fp - iob->dp;
-		*len2 = 0;
+		*len1 = iob->size;
+		*src2 = 0, *len2 = 0;
 		return;
 	}
 
@@ -276,17 +365,43 @@ int iobuffer_drain(struct IOBuffer *iob, ifax_uint8 *dst, int size)
 	return total;
 }
 
-int iobuffer_read(struct IOBuffer *iob, int fd)
+/* The free space as one or two segments, like the data is given by
+ * 'iobuffer_drain_segments'.  Returns the number of segments.
+ */
+
+static int fill_segments(struct IOBuffer *iob, struct iovec *iov)
 {
-	int rc, total = 0;
 	ifax_uint8 *dst;
-	int size;
+	int len;
+
+	iobuffer_fill_segment(iob,&dst,&len);
+	if ( len == 0 )
+		return 0;
+
+	iov[0].iov_base = dst;
+	iov[0].iov_len = len;
+
+	if ( iob->mirrored || iob->fp < iob->dp || iob->dp == 0 )
+		return 1;
+
+	iov[1].iov_base = &iob->data[0];
+	iov[1].iov_len = iob->dp;
+	return 2;
+}
+
+int iobuffer_read(struct IOBuffer *iob, int fd)
+{
+	struct iovec iov[2];
+	int rc, n, size, first, total = 0;
 
 	for (;;) {
-		iobuffer_fill_segment(iob,&dst,&size);
-		if ( size == 0 )
+		if ( (n = fill_segments(iob,iov)) == 0 )
 			break;
-		rc = read(fd,dst,size);
+		first = iov[0].iov_len;
+		size = first + (n > 1 ? iov[1].iov_len : 0);
+
+		rc = readv(fd,iov,n);
+		iob->stats.reads++;
 		if ( rc < 0 ) {
 			if ( errno == EAGAIN )
 				break;
@@ -295,16 +410,30 @@ int iobuffer_read(struct IOBuffer *iob, int fd)
 			printf("Errno1=%d (%s)\n",errno,strerror(errno));
 			exit(69);
 		}
+		if ( rc == 0 )
+			break;
 
+		iob->stats.read_bytes += rc;
 		total += rc;
+
+		/* One segment at a time, so the dump is of contiguous data */
+		if ( rc > first ) {
+			iobuffer_fill_update(iob,first," READ:");
+			iobuffer_fill_update(iob,rc - first," READ:");
+		} else {
+			iobuffer_fill_update(iob,rc," READ:");
+		}
+
+		if ( rc < size )
+			break;
 	}
-	iobuffer_fill_update(iob,total," READ:");
 	return total;
 }
 
 int iobuffer_write(struct IOBuffer *iob, int fd)
 {
 	char prefix[64];
+	struct iovec iov[2];
 	int rc, total = 0;
 	ifax_uint8 *src1, *src2;
 	int len1, len2;
@@ -313,7 +442,14 @@ int iobuffer_write(struct IOBuffer *iob, int fd)
 		iobuffer_drain_segments(iob,&src1,&len1,&src2,&len2);
 		if ( len1 == 0 )
 			break;
-		rc = write(fd,src1,len1);
+
+		iov[0].iov_base = src1;
+		iov[0].iov_len = len1;
+		iov[1].iov_base = src2;
+		iov[1].iov_len = len2;
+
+		rc = writev(fd,iov,len2 > 0 ? 2 : 1);
+		iob->stats.writes++;
 		if ( rc < 0 ) {
 			if ( errno == EAGAIN )
 				break;
@@ -323,14 +459,21 @@ int iobuffer_write(struct IOBuffer *iob, int fd)
 			exit(69);
 		}
 
+		iob->stats.write_bytes += rc;
+
 		if ( iob->debug & WRITE ) {
 			strcpy(prefix,iob->descr);
 			strcat(prefix," WRITE:");
-			iodump(prefix,src1,rc);
+			iodump(prefix,src1,rc < len1 ? rc : len1);
+			if ( rc > len1 )
+				iodump(prefix,src2,rc - len1);
 		}
 
 		total += rc;
 		iobuffer_drain_update(iob,rc);
+
+		if ( rc < len1 + len2 )
+			break;		/* The other end is full */
 	}
 
 	if ( iob->debug & WRITE )
@@ -338,3 +481,172 @@ int iobuffer_write(struct IOBuffer *iob, int fd)
 
 	return total;
 }
+
+/* Writing out data as soon as there is some costs a system call for
+ * every little bit.  With batching, the data is held back until there
+ * is about as much as is filled in 'defer' calls, judged from how fast
+ * it has been filled lately, but never for more than 'defer' calls in
+ * a row.  A 'defer' of 0 turns batching off.
+ */
+
+void iobuffer_batch(struct IOBuffer *iob, int defer)
+{
+	iob->batch_defer = defer;
+	iob->batch_waited = 0;
+	iob->batch_mark = iob->filled;
+}
+
+int iobuffer_write_batched(struct IOBuffer *iob, int fd)
+{
+	long fresh, target;
+
+	fresh = (ifax_uint32)(iob->filled - iob->batch_mark);
+	iob->batch_mark = iob->filled;
+	iob->batch_rate += (fresh * 16 - iob->batch_rate) / 8;
+
+	if ( iob->batch_defer > 0 && iob->batch_waited < iob->batch_defer ) {
+		target = iob->batch_rate * iob->batch_defer / 16;
+		if ( target > iob->total / 2 )
+			target = iob->total / 2;
+		if ( iob->size < target ) {
+			iob->batch_waited++;
+			return 0;
+		}
+	}
+
+	iob->batch_waited = 0;
+	return iobuffer_write(iob,fd);
+}
+
+/* Log the system calls per second and bytes per call since the last
+ * time.  Only the 'reported' copy is changed, so this may be called
+ * from another thread than the one doing the I/O.
+ */
+
+void iobuffer_stats_dump(struct IOBuffer *iob)
+{
+	struct IOStats now = iob->stats;
+	struct IOStats *then = &iob->reported;
+	unsigned long reads, writes;
+	double secs;
+
+	gettimeofday(&now.since,0);
+	secs = (now.since.tv_sec - then->since.tv_sec)
+		+ (now.since.tv_usec - then->since.tv_usec) / 1000000.0;
+	if ( secs <= 0.0 )
+		return;
+
+	reads = now.reads - then->reads;
+	writes = now.writes - then->writes;
+
+	ifax_dprintf(DEBUG_INFO,"%s: %.1f reads/s of %.1f bytes, "
+		     "%.1f writes/s of %.1f bytes\n",iob->descr,
+		     reads / secs,
+		     reads ? (double)(now.read_bytes - then->read_bytes)
+		     / reads : 0.0,
+		     writes / secs,
+		     writes ? (double)(now.write_bytes - then->write_bytes)
+		     / writes : 0.0);
+
+	*then = now;
+}
+
+
+/* The IORing is the same kind of ring buffer, made for passing data
+ * from one thread to another without locking.  The filling thread is
+ * the only one to move 'fp' and the draining thread the only one to
+ * move 'dp'.  Both count bytes from the start and are never wrapped;
+ * the ring size is a power of two, so the position in the ring is
+ * found by masking and the amount of data is simply 'fp - dp'.
+ */
+
+#ifdef __GNUC__
+#define ioring_barrier()	__sync_synchronize()
+#else
+#define ioring_barrier()
+#endif
+
+struct IORing *ioring_allocate(int size, char *devinfo)
+{
+	struct IORing *ior;
+	int total;
+
+	for ( total=1; total < size; total <<= 1 )
+		;
+
+	ior = ifax_malloc(sizeof(*ior),"IORing instance");
+	ior->data = ifax_malloc(total,"IORing data");
+	ior->fp = ior->dp = 0;
+	ior->mask = total - 1;
+	strcpy(ior->descr,devinfo);
+
+	return ior;
+}
+
+int ioring_used(struct IORing *ior)
+{
+	return ior->fp - ior->dp;
+}
+
+int ioring_room(struct IORing *ior)
+{
+	return ior->mask + 1 - (ior->fp - ior->dp);
+}
+
+/* Copy 'size' bytes into the ring, all or nothing.  Returns the number
+ * of bytes copied.  Only to be called by the filling thread.
+ */
+
+int ioring_fill(struct IORing *ior, void *src, int size)
+{
+	ifax_uint32 pos, chunk;
+
+	if ( size <= 0 || ioring_room(ior) < size )
+		return 0;
+
+	pos = ior->fp & ior->mask;
+	chunk = ior->mask + 1 - pos;
+	if ( chunk > size )
+		chunk = size;
+
+	memcpy(&ior->data[pos],src,chunk);
+	memcpy(&ior->data[0],(ifax_uint8 *)src + chunk,size - chunk);
+
+	/* The data must be in place before the other thread sees it */
+	ioring_barrier();
+	ior->fp += size;
+
+	return size;
+}
+
+/* Copy up to 'size' bytes out of the ring.  Returns the number of bytes
+ * copied.  Only to be called by the draining thread.
+ */
+
+int ioring_drain(struct IORing *ior, void *dst, int size)
+{
+	ifax_uint32 pos, chunk;
+	int used;
+
+	if ( (used = ioring_used(ior)) < size )
+		size = used;
+	if ( size <= 0 )
+		return 0;
+
+	/* Don't read the data before seeing it is there */
+	ioring_barrier();
+
+	pos = ior->dp & ior->mask;
+	chunk = ior->mask + 1 - pos;
+	if ( chunk > size )
+		chunk = size;
+
+	memcpy(dst,&ior->data[pos],chunk);
+	memcpy((ifax_uint8 *)dst + chunk,&ior->data[0],size - chunk);
+
+	/* The data must be copied before the space is handed back */
+	ioring_barrier();
+	ior->dp += size;
+
+	return size;
+}
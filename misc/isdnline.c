@@ -138,6 +138,29 @@ static void isdn_initialize(struct HardwareHandle *hh)
 		ih->fd = -1;
 		return;
 	}
+
+	if ( ih->el != 0 ) {
+		ih->source.fd = ih->fd;
+		eventloop_add(ih->el,&ih->source);
+	}
+}
+
+
+/* Register with an event loop; the device is added when it is opened */
+
+static void isdn_attach(struct HardwareHandle *hh, struct EventLoop *el,
+			event_handler handler, void *context)
+{
+	struct IsdnHandle *ih = hh->private;
+
+	ih->el = el;
+	ih->source.handler = handler;
+	ih->source.context = context;
+
+	if ( ih->fd >= 0 ) {
+		ih->source.fd = ih->fd;
+		eventloop_add(el,&ih->source);
+	}
 }
 
 
@@ -153,8 +176,6 @@ static void isdn_service_select(struct HardwareHandle *hh, fd_set *rfd,
 {
 	struct IsdnHandle *ih = hh->private;
 
-	static hardware_state_t last_state = 999999;	/* none */
-
 	static char *device_state[9] = {
 		"UNKNOWN",
 		"INITIALIZING",
@@ -167,25 +188,113 @@ static void isdn_service_select(struct HardwareHandle *hh, fd_set *rfd,
 		"NOANSWER"
 	};
 
-	if ( hh->state != last_state ) {
-		ifax_dprintf(DEBUG_DEBUG,"Changed state to %s\n",
-			     device_state[hh->state]);
-		last_state = hh->state;
+	if ( hh->state != ih->last_state ) {
+		ifax_dprintf(DEBUG_DEBUG,"%s: Changed state to %s\n",
+			     ih->device,device_state[hh->state]);
+		ih->last_state = hh->state;
 	}
 
-	if ( (rfd == 0 || FD_ISSET(ih->fd,rfd)) && !hh->error )
+	if ( (rfd == 0 || FD_ISSET(ih->fd,rfd)) && !hh->error
+	     && ih->fd >= 0 ) {
 		iobuffer_read(ih->incomming_buffer,ih->fd);
+		hh->pending = ih->incomming_buffer->size
+			== ih->incomming_buffer->total;
+	}
 
 	fsm_run(ih->smh);
 }
 
 
+/* Count the DLE bytes in a block of a-Law codes.  Four bytes are
+ * checked at a time (a word with a DLE has a zero byte after the xor),
+ * and only the words holding one are looked at byte by byte.
+ */
+
+#define HAS_ZERO_BYTE(w)	(((w) - 0x01010101) & ~(w) & 0x80808080)
+
+int count_dle(ifax_uint8 *p, int len)
+{
+	ifax_uint32 w;
+	int n = 0, k;
+
+	for ( ; len >= 4; p += 4, len -= 4 ) {
+		memcpy(&w,p,4);
+		w ^= 0x10101010;
+		if ( HAS_ZERO_BYTE(w) )
+			for ( k=0; k < 4; k++ )
+				n += p[k] == ISDNTTY_DLE;
+	}
+
+	while ( len-- > 0 )
+		n += *p++ == ISDNTTY_DLE;
+
+	return n;
+}
+
+/* Find the first DLE byte in a block, the same way as above.  Returns
+ * 'len' if there is none.
+ */
+
+int find_dle(ifax_uint8 *p, int len)
+{
+	ifax_uint32 w;
+	int n;
+
+	for ( n=0; n + 4 <= len; n += 4 ) {
+		memcpy(&w,p+n,4);
+		w ^= 0x10101010;
+		if ( HAS_ZERO_BYTE(w) )
+			break;
+	}
+
+	while ( n < len && p[n] != ISDNTTY_DLE )
+		n++;
+
+	return n;
+}
+
+/* Double the 'dles' DLE bytes among the first 'len' bytes of 'buf', in
+ * place.  Working from the end, nothing is overwritten before it has
+ * been moved, and the bytes before the first DLE stay where they are.
+ */
+
+void stuff_dle(ifax_uint8 *buf, int len, int dles)
+{
+	ifax_uint8 *src = buf + len, *dst = buf + len + dles;
+
+	while ( dst != src ) {
+		if ( (*--dst = *--src) == ISDNTTY_DLE )
+			*--dst = ISDNTTY_DLE;
+	}
+}
+
+/* Encode 'cnt' samples as they go to the ISDN device: A-law with the
+ * DLE bytes doubled.  'dst' needs room for 2*cnt bytes, and the number
+ * of bytes used is returned.  The samples are modified like for
+ * 'isdn_write_samples' below.
+ */
+
+int isdn_encode_samples(ifax_sint16 *src, ifax_uint8 *dst, int cnt)
+{
+	int dles;
+
+	sint2wala_block(src,dst,cnt);
+
+	if ( (dles = count_dle(dst,cnt)) > 0 )
+		stuff_dle(dst,cnt,dles);
+
+	return cnt + dles;
+}
+
 /*
  * Write a set of voice samples to the ISDN device.  The samples are in the
  * form of an array, containing 16-bit signed, linear values.
  * The array is *modified* by this function to the linear values actually
  * transmitted.  This is to help an echo cancel function to work on the true
  * values as sent over the ISDN line to the remote end.
+ *
+ * The A-law bytes are put straight into the output buffer when they fit,
+ * and the DLE bytes are only looked for and doubled when there are any.
  */
 
 #define ISDN_MAX_WRITE	4096
@@ -194,9 +303,9 @@ static void isdn_write_samples(struct HardwareHandle *hh,
 			       ifax_sint16 *src, int cnt)
 {
 	struct IsdnHandle *ih = hh->private;
-	ifax_uint8 *dst, wala;
-	ifax_uint16 linear;
+	ifax_uint8 *start;
 	ifax_uint8 tmp[2 * ISDN_MAX_WRITE];
+	int room, dles;
 
 	if ( cnt > ISDN_MAX_WRITE ) {
 	  ifax_dprintf(DEBUG_ERROR,"Dropping %d samples in isdn_write_samples",
@@ -204,20 +313,97 @@ static void isdn_write_samples(struct HardwareHandle *hh,
 	  cnt = ISDN_MAX_WRITE;
 	}
 
-	dst = &tmp[0];
+	iobuffer_fill_segment(ih->outgoing_buffer,&start,&room);
+	if ( room < cnt )
+		start = &tmp[0];
+
+	sint2wala_block(src,start,cnt);
 
-	while ( cnt-- > 0 ) {
+	if ( (dles = count_dle(start,cnt)) > 0 ) {
+		if ( start != &tmp[0] && room < cnt + dles ) {
+			memcpy(tmp,start,cnt);
+			start = &tmp[0];
+		}
+		stuff_dle(start,cnt,dles);
+	}
+
+	if ( start == &tmp[0] )
+		iobuffer_fill(ih->outgoing_buffer, &tmp[0], cnt + dles);
+	else
+		iobuffer_fill_update(ih->outgoing_buffer, cnt + dles, " FILL:");
+}
 
-		linear = (ifax_uint16) *src;
-		wala = sint2wala[linear>>4];
-		*src++ = 8 * wala2sint[wala];	/* fill with quantized value */
 
-		if ( wala == ISDNTTY_DLE )
-			*dst++ = wala;
-		*dst++ = wala;
+/* A DLE followed by anything but another DLE is an event from the
+ * ISDN device, like DTMF digits, detected tones or the end of the audio
+ * (DLE ETX).  They are logged, and a DLE ETX has the state machine hang
+ * up, as the call is over.
+ */
+
+static void isdn_event(struct IsdnHandle *ih, ifax_uint8 code)
+{
+	if ( code >= 32 && code < 127 )
+		ifax_dprintf(DEBUG_INFO,"%s: Event DLE '%c'\n",ih->device,code);
+	else
+		ifax_dprintf(DEBUG_INFO,"%s: Event DLE 0x%02x\n",ih->device,code);
+
+	if ( code == ISDNTTY_ETX )
+		ih->request_hangup = 1;
+}
+
+/*
+ * Read a set of voice samples from the ISDN device.  The runs of A-law
+ * bytes between the DLEs are converted in one go, straight from the
+ * input buffer; a DLE DLE gives a sample with the DLE value, and other
+ * DLE codes go to 'isdn_event'.  A DLE at the very end is left in the
+ * buffer until the byte after it has arrived.
+ */
+
+static int isdn_read_samples(struct HardwareHandle *hh,
+			     ifax_sint16 *dst, int cnt)
+{
+	struct IsdnHandle *ih = hh->private;
+	ifax_uint8 *src1, *src2, code;
+	int len1, len2, run, n = 0;
+
+	ih->plain = 0;			/* The input is not messages now */
+
+	while ( n < cnt ) {
+
+		iobuffer_drain_segments(ih->incomming_buffer,
+					&src1,&len1,&src2,&len2);
+		if ( len1 == 0 )
+			break;
+
+		if ( len1 > cnt - n )
+			run = find_dle(src1,cnt - n);
+		else
+			run = find_dle(src1,len1);
+
+		if ( run > 0 ) {
+			wala2sint_block(src1,&dst[n],run);
+			iobuffer_drain_update(ih->incomming_buffer,run);
+			n += run;
+			continue;
+		}
+
+		/* At a DLE; look at the code after it */
+		if ( len1 > 1 )
+			code = src1[1];
+		else if ( len2 > 0 )
+			code = src2[0];
+		else
+			break;
+
+		iobuffer_drain_update(ih->incomming_buffer,2);
+
+		if ( code == ISDNTTY_DLE )
+			dst[n++] = 8 * wala2sint[ISDNTTY_DLE];
+		else
+			isdn_event(ih,code);
 	}
 
-	iobuffer_fill(ih->outgoing_buffer, &tmp[0], dst - &tmp[0]);
+	return n;
 }
 
 
@@ -258,13 +444,33 @@ static void isdn_configure(struct HardwareHandle *hh, char *param, char *value)
 /* The following function needs to be called before going to sleep on a
  * select, so that we fill the ISDN output buffer so that will not
  * underrun anytime soon.
+ *
+ * While online, the samples are written in batches of a few ticks
+ * worth, rather than a system call for every tick.  AT commands are
+ * written at once.
  */
 
+#define ISDN_WRITE_DEFER	2
+
 void isdn_service_readwrite(struct HardwareHandle *hh)
 {
 	struct IsdnHandle *ih = hh->private;
-	
-	iobuffer_write(ih->outgoing_buffer,ih->fd);
+
+	if ( ih->fd < 0 )
+		return;
+
+	if ( hh->state == ONLINE )
+		iobuffer_write_batched(ih->outgoing_buffer,ih->fd);
+	else
+		iobuffer_write(ih->outgoing_buffer,ih->fd);
+}
+
+static void isdn_stats(struct HardwareHandle *hh)
+{
+	struct IsdnHandle *ih = hh->private;
+
+	iobuffer_stats_dump(ih->incomming_buffer);
+	iobuffer_stats_dump(ih->outgoing_buffer);
 }
 
 
@@ -301,6 +507,8 @@ void isdn_dial(struct HardwareHandle *hh, char *number)
 
 FSM_DEFSTATE(isdn_start_state)
 
+static void matcher_build(void);
+
 void isdn_allocate(struct HardwareHandle *hh)
 {
 	struct IsdnHandle *ih;
@@ -313,23 +521,29 @@ void isdn_allocate(struct HardwareHandle *hh)
 	fsm_init(ih->smh,0,isdn_start_state,100,hh);	/* Initialize */
 
 	ih->fd = -1;
+	ih->last_state = -1;				/* none logged */
 	ih->device[0] = '\0';
 	ih->ourmsn[0] = '\0';
 	ih->remotemsn[0] = '\0';
 
-	ih->incomming_buffer = iobuffer_allocate(512,"ISDN/I");
-	ih->outgoing_buffer = iobuffer_allocate(512,"ISDN/O");
+	matcher_build();			/* Shared by all lines */
+
+	ih->incomming_buffer = iobuffer_allocate_mirrored(512,"ISDN/I");
+	ih->outgoing_buffer = iobuffer_allocate_mirrored(512,"ISDN/O");
+	iobuffer_batch(ih->outgoing_buffer,ISDN_WRITE_DEFER);
 
 	hh->configure = isdn_configure;
 	hh->initialize = isdn_initialize;
 
 	hh->prepare_select = isdn_prepare_select;
 	hh->service_select = isdn_service_select;
-	/*	hh->read = ___; */
+	hh->attach = isdn_attach;
+	hh->read = isdn_read_samples;
 	hh->write = isdn_write_samples;
 	hh->service_readwrite = isdn_service_readwrite;
 	hh->dial = isdn_dial;
 	/*	hh->hangup = ___; */
+	hh->stats = isdn_stats;
 }
 
 /***************************************************************************
@@ -495,6 +709,7 @@ FSM_END
  */
 
 FSM_DEFSTATE(endless_loop)
+FSM_DEFSTATE(isdn_hangup_call)
 FSM_DEFSTATE(isdn_start_dial2)
 FSM_DEFSTATE(isdn_start_dial3)
 
@@ -519,8 +734,20 @@ FSM_STATE(NEEDS_none,isdn_start_dial3)
 	FSMJUMP(endless_loop);
 FSM_END
 
-FSM_STATE(NEEDS_none,endless_loop)
-	/* Keep spending time here ... */
+FSM_STATE(NEEDS_ih,endless_loop)
+	/* Keep spending time here until the call is over */
+	if ( ih->request_hangup )
+		FSMJUMP(isdn_hangup_call);
+FSM_END
+
+/* After a DLE ETX the device is back in command mode, so the line is
+ * hung up and made ready for the next call.
+ */
+
+FSM_STATE(NEEDS_ih,isdn_hangup_call)
+	ifax_dprintf(DEBUG_INFO,"%s: Hanging up\n",ih->device);
+	strcpy(ih->at_cmd,"ATH");
+	FSMCALLJUMP(do_at_command_with_OK,isdn_enter_idle_state,0);
 FSM_END
 
 
@@ -558,6 +785,7 @@ FSM_STATE(NEEDS_local_ih,isdn_junk_incomming_swallow)
 	if ( ih->incomming_buffer->size > 0 ) {
 		/* There is some 'junk' - throw it away and reset timer */
 		iobuffer_reset(ih->incomming_buffer);
+		ih->plain = 0;
 		hard_timer_init(&local->htimer2,JUNK_INCOMMING_SILENCE_TIME);
 		FSMYIELD;
 	}
@@ -698,6 +926,129 @@ static struct {
 	{ 0, 0, 0 }			/* Terminate list */
 };
 
+/* The messages are recognized by an automaton made from the table above
+ * (Aho-Corasick): Every state is a prefix of one or more messages, and
+ * the transitions out of it lead to the longest prefix that is a suffix
+ * of what has been read.  One pass over the input then finds where the
+ * first message starts.  The bytes before it are handed out one by one
+ * without looking at them again, the count kept in 'ih->plain'.
+ */
+
+#define MATCH_STATES	128
+
+static struct {
+	ifax_uint8 next[256];		/* Next state for each input byte */
+	ifax_uint8 depth;		/* Length of the prefix */
+	ifax_uint8 accept;		/* Message equal to the prefix, or 0 */
+	ifax_uint8 output;		/* Longest accepting suffix, or 0 */
+	ifax_uint8 more;		/* Nonzero if prefix of a longer one */
+} matcher[MATCH_STATES];
+
+static int matcher_states = 0;
+
+static void matcher_build(void)
+{
+	ifax_uint8 fail[MATCH_STATES], queue[MATCH_STATES];
+	int t, i, c, r, s, head, tail;
+	ifax_uint8 *str;
+
+	if ( matcher_states != 0 )
+		return;				/* Already made */
+
+	/* The states of the prefixes, with the transitions between them */
+	matcher_states = 1;
+	for ( t=1; isdn_message[t].length != 0; t++ ) {
+		str = (ifax_uint8 *)isdn_message[t].string;
+		s = 0;
+		for ( i=0; i < isdn_message[t].length; i++ ) {
+			if ( matcher[s].next[str[i]] == 0 ) {
+				if ( matcher_states == MATCH_STATES ) {
+					ifax_dprintf(DEBUG_SEVERE,
+						     "Too many ISDN messages\n");
+					exit(1);
+				}
+				matcher[s].more = 1;
+				matcher[s].next[str[i]] = matcher_states;
+				matcher[matcher_states].depth = i + 1;
+				matcher_states++;
+			}
+			s = matcher[s].next[str[i]];
+		}
+		if ( matcher[s].accept == 0 )
+			matcher[s].accept = t;
+	}
+
+	/* Fill in the rest of the transitions, shortest prefixes first.
+	 * A transition to a state one longer is one of those above.
+	 */
+	head = tail = 0;
+	queue[tail++] = 0;
+	fail[0] = 0;
+
+	while ( head < tail ) {
+		r = queue[head++];
+		matcher[r].output = matcher[r].accept ? r
+			: matcher[fail[r]].output;
+		for ( c=0; c < 256; c++ ) {
+			s = matcher[r].next[c];
+			if ( s != 0 && matcher[s].depth == matcher[r].depth+1 ) {
+				fail[s] = r == 0 ? 0 : matcher[fail[r]].next[c];
+				queue[tail++] = s;
+			} else {
+				matcher[r].next[c] = r == 0 ? 0
+					: matcher[fail[r]].next[c];
+			}
+		}
+	}
+}
+
+/* Returns the offset of the first byte where a message starts, or may
+ * start in the data not read yet, or 'len' if there is none.
+ */
+
+int matcher_scan(ifax_uint8 *buf, int len)
+{
+	int i, s = 0, o, first = len;
+
+	for ( i=0; i < len; i++ ) {
+		s = matcher[s].next[buf[i]];
+		o = matcher[s].output;
+		if ( o != 0 && i + 1 - matcher[o].depth < first )
+			first = i + 1 - matcher[o].depth;
+		if ( i + 1 - matcher[s].depth >= first )
+			return first;		/* Nothing can start earlier */
+	}
+
+	if ( len - matcher[s].depth < first )
+		first = len - matcher[s].depth;
+
+	return first;
+}
+
+/* Find the longest message at the very start of 'buf'.  Returns its
+ * state, or 0 if none.  'partial' is set if all of 'buf' is the start of
+ * a (longer) message.
+ */
+
+int matcher_anchored(ifax_uint8 *buf, int len, int *partial)
+{
+	int i, s = 0, t, best = 0;
+
+	*partial = 0;
+
+	for ( i=0; i < len; i++ ) {
+		t = matcher[s].next[buf[i]];
+		if ( matcher[t].depth != i + 1 )
+			return best;
+		s = t;
+		if ( matcher[s].accept != 0 )
+			best = s;
+	}
+
+	*partial = matcher[s].more;
+	return best;
+}
+
 FSM_DEFSTATE(isdn_get_next_msg2)
 FSM_DEFSTATE(isdn_get_next_msg3)
 FSM_DEFSTATE(isdn_get_next_msg4)
@@ -735,11 +1086,15 @@ FSM_STATE(NEEDS_local,isdn_get_next_msg3)
 FSM_END
 
 FSM_STATE(NEEDS_local_ih,isdn_get_next_msg4)
-	char *s1, *s2;
-	int t, length, x, partial_match, complete_match;
-	unsigned char tmp[128];
-
-	x = iobuffer_drain(ih->incomming_buffer,(unsigned char *)&tmp[0],100);
+	int t, x, x2, partial;
+	unsigned char tmp[128], *buf, *buf2;
+
+	/* The input is looked at in place, unless it wraps around */
+	iobuffer_drain_segments(ih->incomming_buffer,&buf,&x,&buf2,&x2);
+	if ( x2 > 0 ) {
+		x = iobuffer_drain(ih->incomming_buffer,&tmp[0],100);
+		buf = &tmp[0];
+	}
 	
 	/* Return if no data available after the delay */
 	if ( x == 0 ) {
@@ -748,35 +1103,34 @@ FSM_STATE(NEEDS_local_ih,isdn_get_next_msg4)
 		FSMYIELD;
 	}
 
+	/* Bytes known not to start a message go out as they are */
+	if ( ih->plain == 0 )
+		ih->plain = matcher_scan(buf,x);
+
+	if ( ih->plain > 0 ) {
+		ih->plain--;
+		t = buf[0];
+		iobuffer_drain_update(ih->incomming_buffer,1);
+		FSMRETURN(t);
+	}
+
 	/* Check if there is a message, or if there might be one
 	 * building up (only parts of it read so far).
 	 */
-	complete_match = partial_match = 0;
-	for ( t=1; isdn_message[t].length != 0; t++ ) {
-		length = isdn_message[t].length;
-		s1 = (char *)&tmp[0];
-		s2 = isdn_message[t].string;
-		if ( !complete_match && x >= length && !strncmp(s1,s2,length) )
-			complete_match = t;
-		
-		if ( x < length && !strncmp(s1,s2,x) ) {
-			partial_match = t;
-			break;
-		}
-	}
+	t = matcher_anchored(buf,x,&partial);
 
 	/* If we have partial matches, wait the timeout period for more */
-	if ( partial_match && !hard_timer_expired(&local->htimer1) )
+	if ( partial && !hard_timer_expired(&local->htimer1) )
 		FSMYIELD;
 
-	if ( complete_match ) {
-		length = isdn_message[complete_match].length;
-		iobuffer_drain_update(ih->incomming_buffer,length);
-		FSMRETURN(isdn_message[complete_match].message);
+	if ( t != 0 ) {
+		iobuffer_drain_update(ih->incomming_buffer,matcher[t].depth);
+		FSMRETURN(isdn_message[matcher[t].accept].message);
 	}
 
+	t = buf[0];
 	iobuffer_drain_update(ih->incomming_buffer,1);
-	FSMRETURN(tmp[0]);
+	FSMRETURN(t);
 FSM_END
 
 #if 0
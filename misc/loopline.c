@@ -0,0 +1,315 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Hardware driver connecting two lines of the daemon to each other
+  
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+/* This hardware driver connects two lines of the daemon to each other,
+ * so what one line transmits can be received by the other without any
+ * telephony hardware (see 'test_loopback_frame' in test.c, where a HDLC
+ * frame is passed from one end to the other).  The two ends are given
+ * the same pair name in the configuration file, and the call is
+ * connected as soon as both have been initialized.  It lasts until one
+ * of the ends hangs up, or for a given number of seconds.  Until ATD
+ * and ATA start the fax state-machines, both ends send silence.
+ *
+ * What one end transmits is quantized to A-law like on an ISDN line,
+ * and received by the other end 'delay' samples later.  The samples
+ * are passed in a lock-free ring each way, so the two lines may be
+ * served by different threads.  Like the "file" driver, the call is not
+ * tied to the clock, but run as fast as the CPU allows, and the speed
+ * is logged when it ends.
+ *
+ * Every sample an end receives is answered by one it transmits, so the
+ * two rings together always hold twice the delay.  This also limits
+ * how many samples are moved each time the ends are serviced; a delay
+ * of only a few samples will make the call slow.
+ *
+ * Configuration:
+ *
+ *	hardware = loopback
+ *	loopback-pair = fax1
+ *	loopback-delay = 160		(samples, optional)
+ *	loopback-length = 120		(seconds, optional)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include <ifax/ifax.h>
+#include <ifax/alaw.h>
+#include <ifax/misc/loopline.h>
+#include <ifax/misc/malloc.h>
+#include <ifax/misc/iobuffer.h>
+#include <ifax/misc/hardware-driver.h>
+
+/* All pairs, so the second end can find the first */
+
+static struct LoopbackPair *pairs = 0;
+
+
+static void loopback_configure(struct HardwareHandle *hh, char *param,
+			       char *value)
+{
+	struct LoopbackHandle *lh = hh->private;
+	long number;
+	char *end;
+
+	if ( !strcmp(param,"pair") ) {
+		if ( strlen(value) >= LOOPBACK_NAME_SIZE ) {
+			hh->error = 1;
+			sprintf(hh->errormsg,"loopback-pair is too long");
+			return;
+		}
+		strcpy(lh->name,value);
+		return;
+	}
+
+	number = strtol(value,&end,10);
+
+	if ( !strcmp(param,"delay") ) {
+		if ( *end != '\0' || number < 1 || number > 80000 ) {
+			hh->error = 1;
+			sprintf(hh->errormsg,"loopback-delay must be 1-80000");
+			return;
+		}
+		lh->delay = number;
+		return;
+	}
+
+	if ( !strcmp(param,"length") ) {
+		if ( *end != '\0' || number < 0 || number > 86400 ) {
+			hh->error = 1;
+			sprintf(hh->errormsg,"loopback-length must be 0-86400");
+			return;
+		}
+		lh->length = number * 8000;
+		return;
+	}
+
+	hh->error = 1;
+	sprintf(hh->errormsg,"Unrecognized configuration option '%s'",param);
+}
+
+/* Put 'delay' samples of silence in the ring, so the other end will
+ * receive the first samples transmitted that much later.
+ */
+
+static void precharge(struct IORing *ior, int delay)
+{
+	static ifax_sint16 silence[256];
+	int n;
+
+	while ( delay > 0 ) {
+		n = delay > 256 ? 256 : delay;
+		ioring_fill(ior,silence,n*sizeof(ifax_sint16));
+		delay -= n;
+	}
+}
+
+static void connect_pair(struct LoopbackPair *pair)
+{
+	struct LoopbackHandle *a = pair->end[0], *b = pair->end[1];
+	int size;
+
+	size = 4 * (a->delay + b->delay) * sizeof(ifax_sint16);
+
+	a->tx = b->rx = ioring_allocate(size,"Loopback ring");
+	b->tx = a->rx = ioring_allocate(size,"Loopback ring");
+
+	precharge(a->tx,a->delay);
+	precharge(b->tx,b->delay);
+
+	gettimeofday(&a->start,(struct timezone *)0);
+	b->start = a->start;
+
+	a->hh->state = ONLINE;
+	b->hh->state = ONLINE;
+}
+
+/* The lines are initialized one at a time before any of them is
+ * served, so the list of pairs needs no locking.
+ */
+
+static void loopback_initialize(struct HardwareHandle *hh)
+{
+	struct LoopbackHandle *lh = hh->private;
+	struct LoopbackPair *pair;
+
+	for ( pair=pairs; pair != 0; pair = pair->next )
+		if ( !strcmp(pair->name,lh->name) )
+			break;
+
+	if ( pair == 0 ) {
+		pair = ifax_malloc(sizeof(*pair),"Loopback pair");
+		strcpy(pair->name,lh->name);
+		pair->next = pairs;
+		pairs = pair;
+	} else if ( pair->end[1] != 0 ) {
+		hh->error = 1;
+		sprintf(hh->errormsg,"Loopback pair '%s' has more than two ends",
+			lh->name);
+		return;
+	}
+
+	lh->side = pair->end[0] != 0;
+	lh->pair = pair;
+	pair->end[lh->side] = lh;
+	hh->state = IDLE;
+
+	if ( lh->side == 1 )
+		connect_pair(pair);
+}
+
+/* The call is over for this end; tell how fast it went */
+
+static void loopback_finish(struct HardwareHandle *hh)
+{
+	struct LoopbackHandle *lh = hh->private;
+	struct timeval now;
+	double elapsed;
+
+	if ( hh->state != ONLINE )
+		return;
+
+	gettimeofday(&now,(struct timezone *)0);
+	elapsed = (now.tv_sec - lh->start.tv_sec)
+		+ (now.tv_usec - lh->start.tv_usec) / 1000000.0;
+
+	ifax_dprintf(DEBUG_INFO,
+		     "Loopback %s/%d: %ld samples in %.3f s (%.0f x real time)\n",
+		     lh->name,lh->side,lh->samples,elapsed,
+		     elapsed > 0 ? lh->samples / 8000.0 / elapsed : 0.0);
+
+	hh->state = IDLE;
+	hh->pending = 0;
+}
+
+static void loopback_hangup(struct HardwareHandle *hh)
+{
+	struct LoopbackHandle *lh = hh->private;
+
+	if ( lh->pair != 0 )
+		lh->pair->hungup = 1;
+	loopback_finish(hh);
+}
+
+/* There is always something to do while the call lasts */
+
+static void loopback_service_select(struct HardwareHandle *hh, fd_set *rfd,
+				    fd_set *wfd, fd_set *efd)
+{
+	struct LoopbackHandle *lh = hh->private;
+
+	if ( hh->state != ONLINE )
+		return;
+
+	if ( lh->pair->hungup ) {
+		loopback_finish(hh);
+		return;
+	}
+
+	hh->pending = 1;
+}
+
+static void loopback_prepare_select(struct HardwareHandle *hh, int *maxfd,
+				    fd_set *rfd, fd_set *wfd, fd_set *efd)
+{
+}
+
+static void loopback_attach(struct HardwareHandle *hh, struct EventLoop *el,
+			    event_handler handler, void *context)
+{
+}
+
+static int loopback_read_samples(struct HardwareHandle *hh,
+				 ifax_sint16 *dst, int cnt)
+{
+	struct LoopbackHandle *lh = hh->private;
+	int n;
+
+	if ( hh->state != ONLINE )
+		return 0;
+
+	if ( lh->pair->hungup ) {
+		loopback_finish(hh);
+		return 0;
+	}
+
+	if ( lh->length > 0 && cnt > lh->length - lh->samples )
+		cnt = lh->length - lh->samples;
+
+	n = ioring_drain(lh->rx,dst,cnt*sizeof(ifax_sint16))
+		/ sizeof(ifax_sint16);
+	lh->samples += n;
+
+	if ( lh->length > 0 && lh->samples >= lh->length )
+		loopback_hangup(hh);
+
+	return n;
+}
+
+/* Same quantization as on the ISDN line, see 'isdn_write_samples' */
+
+static void loopback_write_samples(struct HardwareHandle *hh,
+				   ifax_sint16 *src, int cnt)
+{
+	struct LoopbackHandle *lh = hh->private;
+	ifax_uint16 linear;
+	int t;
+
+	if ( hh->state != ONLINE )
+		return;
+
+	for ( t=0; t < cnt; t++ ) {
+		linear = (ifax_uint16) src[t];
+		src[t] = 8 * wala2sint[sint2wala[linear>>4]];
+	}
+
+	if ( !ioring_fill(lh->tx,src,cnt*sizeof(ifax_sint16)) )
+		ifax_dprintf(DEBUG_ERROR,"Loopback %s/%d: %d samples lost\n",
+			     lh->name,lh->side,cnt);
+}
+
+void loopback_allocate(struct HardwareHandle *hh)
+{
+	struct LoopbackHandle *lh;
+
+	lh = ifax_malloc(sizeof(*lh),"Loopback hardware driver handle");
+	hh->private = lh;
+	lh->hh = hh;
+	strcpy(lh->name,"loopback");
+	lh->delay = LOOPBACK_DEFAULT_DELAY;
+
+	hh->configure = loopback_configure;
+	hh->initialize = loopback_initialize;
+
+	hh->prepare_select = loopback_prepare_select;
+	hh->service_select = loopback_service_select;
+	hh->attach = loopback_attach;
+	hh->read = loopback_read_samples;
+	hh->write = loopback_write_samples;
+	hh->hangup = loopback_hangup;
+}
@@ -65,8 +65,8 @@ static void pty_open(struct PtyHandle *ph)
 		exit(1);
 	}
 
-	ph->rx.rp = ph->rx.wp = ph->rx.size = 0;
-	ph->tx.rp = ph->tx.wp = ph->tx.size = 0;
+	iobuffer_reset(ph->rx);
+	iobuffer_reset(ph->tx);
 
 	if ( tcgetattr(ph->ptyfd,&tios) ) {
 		ifax_dprintf(DEBUG_LAST,
@@ -83,11 +83,15 @@ static void pty_open(struct PtyHandle *ph)
 			     progname,ph->device,strerror(errno));
 		exit(1);
 	}
+
+	if ( ph->el != 0 ) {
+		ph->source.fd = ph->ptyfd;
+		eventloop_add(ph->el,&ph->source);
+	}
 }
 
 
-static void pty_dump(char *prefix, ifax_uint8 *log1, int logsize1,
-		     ifax_uint8 *log2, int logsize2)
+static void pty_dump(char *prefix, ifax_uint8 *log, int logsize)
 {
 	char buffer[256];
 	char item[8], *i;
@@ -105,15 +109,15 @@ static void pty_dump(char *prefix, ifax_uint8 *log1, int logsize1,
 	wp = 0;
 	prefixlen = strlen(prefix);
 
-	while ( logsize1 > 0 ) {
+	while ( logsize > 0 ) {
 
 		if ( wp == 0 ) {
 			strcpy(buffer,prefix);
 			wp = prefixlen;
 		}
 
-		c = *log1++;
-		logsize1--;
+		c = *log++;
+		logsize--;
 
 		if ( c < 33 ) {
 			i = ctrl[c];
@@ -137,12 +141,6 @@ static void pty_dump(char *prefix, ifax_uint8 *log1, int logsize1,
 			ifax_dprintf(DEBUG_DEBUG,buffer);
 			wp = 0;
 		}
-
-		if ( logsize1 == 0 ) {
-			logsize1 = logsize2;
-			log1 = log2;
-			logsize2 = 0;
-		}
 	}
 
 	if ( wp ) {
@@ -175,6 +173,8 @@ struct PtyHandle *pty_initialize(char *device)
 
 	strcpy(ph->device,device);
 	ph->debug = 7;
+	ph->rx = iobuffer_allocate_mirrored(PTY_BUFFERSIZE,"PTY/I");
+	ph->tx = iobuffer_allocate_mirrored(PTY_BUFFERSIZE,"PTY/O");
 	pty_open(ph);
 
 	return ph;
@@ -190,11 +190,29 @@ void pty_reset(struct PtyHandle *ph)
 	ifax_dprintf(DEBUG_DEBUG, "%s: Resetting pty '%s'\n",
 		     progname,ph->device);
 
+	if ( ph->el != 0 )
+		eventloop_remove(ph->el,&ph->source);
 	close(ph->ptyfd);
 	pty_open(ph);
 }
 
 
+/* Register the pty with an event loop.  The 'handler' is called with
+ * 'context' when the pty becomes readable or writable, also after the
+ * pty has been reset.
+ */
+
+void pty_attach(struct PtyHandle *ph, struct EventLoop *el,
+		event_handler handler, void *context)
+{
+	ph->source.fd = ph->ptyfd;
+	ph->source.handler = handler;
+	ph->source.context = context;
+	ph->el = el;
+	eventloop_add(el,&ph->source);
+}
+
+
 /* This function returns how many bytes can be written to the pty
  * at this instance.  Trying to write more bytes than this function
  * reports possible is undefined.
@@ -202,7 +220,7 @@ void pty_reset(struct PtyHandle *ph)
 
 int pty_write_max(struct PtyHandle *ph)
 {
-	return PTY_BUFFERSIZE - ph->tx.size;
+	return ph->tx->total - ph->tx->size;
 }
 
 
@@ -215,20 +233,21 @@ int pty_write_max(struct PtyHandle *ph)
 
 int pty_write_queued(struct PtyHandle *ph)
 {
-	return ph->tx.size;
+	return ph->tx->size;
 }
 
 
-/* Return how many bytes can be read from the pty.  NOTE: The number of
- * bytes returned here may have to be accessed using two pty_reabbuffer
- * operations.  In other words, this function may return 1000 bytes
- * available for reading, but the first call to pty_readbuffer may only
- * yield 1 byte... The next however will yield the remaining 999 bytes.
+/* Return how many bytes can be read from the pty.  NOTE: Unless the
+ * receive buffer could be mirrored, the number of bytes returned here
+ * may have to be accessed using two pty_readbuffer operations.  In other
+ * words, this function may return 1000 bytes available for reading, but
+ * the first call to pty_readbuffer may only yield 1 byte... The next
+ * however will yield the remaining 999 bytes.
  */
 
 int pty_read_max(struct PtyHandle *ph)
 {
-	return ph->rx.size;
+	return ph->rx->size;
 }
 
 
@@ -240,7 +259,7 @@ int pty_read_max(struct PtyHandle *ph)
 void pty_write(struct PtyHandle *ph, void *buffer, size_t size)
 {
 	ifax_uint8 *dst, *src = buffer;
-	size_t chunk;
+	int chunk;
 	char prefix[256];
 
 	if ( pty_write_max(ph) < size ) {
@@ -252,33 +271,18 @@ void pty_write(struct PtyHandle *ph, void *buffer, size_t size)
 
 	if ( ph->debug & LOG_WRITE ) {
 		sprintf(prefix,"PTY-wrt %s:",ph->device);
-		pty_dump(prefix,buffer,size,0,0);
+		pty_dump(prefix,buffer,size);
 	}
 
-	if ( ph->tx.wp >= ph->tx.rp ) {
-
-		/* Unused space in both ends of buffer */
-		dst = &ph->tx.buffer[ph->tx.wp];
-		chunk = PTY_BUFFERSIZE - ph->tx.wp;
-
-		ph->tx.size += size;
-		if ( chunk > size ) {
-			ph->tx.wp += size;
-			memcpy(dst,src,size);
-		} else {
-			memcpy(dst,src,chunk);
-			if ( (ph->tx.wp = size - chunk) > 0 ) {
-				src += chunk;
-				memcpy(&ph->tx.buffer[0],src,ph->tx.wp);
-			}
-		}
-		return;
+	while ( size > 0 ) {
+		iobuffer_fill_segment(ph->tx,&dst,&chunk);
+		if ( chunk > size )
+			chunk = size;
+		memcpy(dst,src,chunk);
+		iobuffer_fill_update(ph->tx,chunk,0);
+		src += chunk;
+		size -= chunk;
 	}
-
-	/* Unused space in the middle */
-	memcpy(&ph->tx.buffer[ph->tx.wp],src,size);
-	ph->tx.wp += size;
-	ph->tx.size += size;
 }
 
 /* When a select is to be called to wait for things to happen, the
@@ -291,14 +295,14 @@ void pty_prepare_select(struct PtyHandle *ph, int *maxfd,
 			fd_set *rfd, fd_set *wfd)
 {
 	/* read only if rx buffer can hold data */
-	if ( ph->rx.size < PTY_BUFFERSIZE ) {
+	if ( ph->rx->size < ph->rx->total ) {
 		FD_SET(ph->ptyfd,rfd);
 	} else {
 		FD_CLR(ph->ptyfd,rfd);
 	}
 
 	/* Write only if there is anything queued */
-	if ( ph->tx.size > 0 ) {
+	if ( ph->tx->size > 0 ) {
 		FD_SET(ph->ptyfd,wfd);
 	} else {
 		FD_CLR(ph->ptyfd,wfd);
@@ -316,35 +320,21 @@ void pty_prepare_select(struct PtyHandle *ph, int *maxfd,
 
 void pty_service_write(struct PtyHandle *ph)
 {
-	int chunk, rc;
+	ifax_uint8 *src1, *src2;
+	int len1, len2, rc;
 
 	/* Try to flush tx-buffer if there is something queued */
-	if ( ph->tx.size > 0 ) {
-		chunk = PTY_BUFFERSIZE - ph->tx.rp;
-		if ( chunk > ph->tx.size )
-			chunk = ph->tx.size;
-		rc = write(ph->ptyfd,&ph->tx.buffer[ph->tx.rp],chunk);
+	while ( ph->tx->size > 0 ) {
+		iobuffer_drain_segments(ph->tx,&src1,&len1,&src2,&len2);
+		rc = write(ph->ptyfd,src1,len1);
 		if ( rc < 0 ) {
 			if ( errno == EAGAIN )
 				return;
 			goto failed_write;
 		}
-		ph->tx.rp += rc;
-		ph->tx.size -= rc;
-		if ( rc < chunk )
+		iobuffer_drain_update(ph->tx,rc);
+		if ( rc < len1 )
 			return;
-		if ( ph->tx.rp >= PTY_BUFFERSIZE )
-			ph->tx.rp = 0;
-		if ( ph->tx.size > 0 ) {
-			rc = write(ph->ptyfd,&ph->tx.buffer[0],ph->tx.size);
-			if ( rc < 0 ) {
-				if ( errno == EAGAIN )
-					return;
-				goto failed_write;
-			}
-			ph->tx.rp = rc;
-			ph->tx.size -= rc;
-		}
 	}
 
 	return;
@@ -364,57 +354,38 @@ void pty_service_write(struct PtyHandle *ph)
 
 void pty_service_read(struct PtyHandle *ph)
 {
-	int chunk;
 	char prefix[256];
-	ifax_uint8 *log1 = 0, *log2 = 0;
-	int logsize1, logsize2;
-
-	logsize1 = logsize2 = 0;
-
-	/* Try to read if there is space in rx-buffer */
-	if ( (chunk = PTY_BUFFERSIZE - ph->rx.size) == 0 )
-		return;
+	ifax_uint8 *dst;
+	int chunk, rc;
 
-	if ( (PTY_BUFFERSIZE - ph->rx.wp) < chunk )
-		chunk = PTY_BUFFERSIZE - ph->rx.wp;
+	if ( ph->debug & LOG_SERVICE_READ )
+		sprintf(prefix,"PTY-srd %s:",ph->device);
 
-	log1 = &ph->rx.buffer[ph->rx.wp];
-	logsize1 = read(ph->ptyfd,log1,chunk);
-	if ( logsize1 < 0 ) {
-		if ( errno == EAGAIN )
-			return;
-		goto failed_read;
-	}
+	/* Try to read if there is space in rx-buffer.  When the buffer
+	 * is full there may be more to read, and since the event loop
+	 * only reports changes, 'rx_pending' tells to come back for it.
+	 */
+	for (;;) {
+		iobuffer_fill_segment(ph->rx,&dst,&chunk);
+		if ( chunk == 0 )
+			break;
 
-	ph->rx.wp += logsize1;
-	ph->rx.size += logsize1;
-	if ( logsize1 < chunk )
-		goto all_ok;
-
-	ph->rx.wp = 0;
-	if ( (chunk = PTY_BUFFERSIZE - ph->rx.size) == 0 )
-		goto all_ok;
-
-	log2 = &ph->rx.buffer[ph->rx.wp];
-	logsize2 = read(ph->ptyfd,log2,chunk);
-	if ( logsize2 < 0 ) {
-		if ( errno == EAGAIN ) {
-			logsize2 = 0;
-			goto all_ok;
+		rc = read(ph->ptyfd,dst,chunk);
+		if ( rc < 0 ) {
+			if ( errno == EAGAIN )
+				break;
+			goto failed_read;
 		}
-		goto failed_read;
-	}
 
-	ph->rx.wp += logsize2;
-	ph->rx.size += logsize2;
+		if ( ph->debug & LOG_SERVICE_READ )
+			pty_dump(prefix,dst,rc);
+		iobuffer_fill_update(ph->rx,rc,0);
 
- all_ok:
-
-	if ( ph->debug & LOG_SERVICE_READ ) {
-		sprintf(prefix,"PTY-srd %s:",ph->device);
-		pty_dump(prefix,log1,logsize1,log2,logsize2);
+		if ( rc < chunk )
+			break;
 	}
 
+	ph->rx_pending = ph->rx->size == ph->rx->total;
 	return;
 
  failed_read:
@@ -429,23 +400,19 @@ void pty_service_read(struct PtyHandle *ph)
 
 /* The following function sets up a pointer into a buffer and
  * its size, which can be used for direct parsing without copying.
- * The size of the buffer returned may be shorter than the total
- * size of the receive buffer.  Advance the pty by the full size
- * and call 'pty_next_buffer' to get access to the next chunk of
- * data.
+ * The receive buffer is mirrored, so this is normally all the data
+ * received.  Should the mirroring have failed, the size returned may
+ * be shorter; advance the pty by the full size and call
+ * 'pty_readbuffer' again to get access to the next chunk of data.
  */
 
 void pty_readbuffer(struct PtyHandle *ph, ifax_uint8 **buffer, size_t *size)
 {
-	size_t chunk;
+	ifax_uint8 *src2;
+	int len1, len2;
 
-	*buffer = &ph->rx.buffer[ph->rx.rp];
-  
-	chunk = PTY_BUFFERSIZE - ph->rx.rp;
-	if ( ph->rx.size < chunk )
-		chunk = ph->rx.size;
-
-	*size = chunk;
+	iobuffer_drain_segments(ph->rx,buffer,&len1,&src2,&len2);
+	*size = len1;
 }
 
 /* The 'pty_advance' function advances the read buffer without any
@@ -455,28 +422,22 @@ void pty_readbuffer(struct PtyHandle *ph, ifax_uint8 **buffer, size_t *size)
 
 void pty_advance(struct PtyHandle *ph, size_t size)
 {
-	int logsize1, logsize2;
+	ifax_uint8 *src1, *src2;
+	int len1, len2;
 	char prefix[256];
 
 	if ( ph->debug & LOG_ADVANCE_READ ) {
-
 		sprintf(prefix,"PTY-adv %s:",ph->device);
-
-		logsize1 = size;
-		logsize2 = 0;
-		if ( ph->rx.rp + logsize1 > PTY_BUFFERSIZE ) {
-			logsize1 = PTY_BUFFERSIZE - ph->rx.rp;
-			logsize2 = size - logsize1;
+		iobuffer_drain_segments(ph->rx,&src1,&len1,&src2,&len2);
+		if ( size <= len1 ) {
+			pty_dump(prefix,src1,size);
+		} else {
+			pty_dump(prefix,src1,len1);
+			pty_dump(prefix,src2,size - len1);
 		}
-
-		pty_dump(prefix,&ph->rx.buffer[ph->rx.rp],logsize1,
-			 &ph->rx.buffer[0],logsize2);
 	}
-	
-	ph->rx.size -= size;
-	ph->rx.rp += size;
-	if ( ph->rx.rp >= PTY_BUFFERSIZE )
-		ph->rx.rp -= PTY_BUFFERSIZE;
+
+	iobuffer_drain_update(ph->rx,size);
 }
 
 
@@ -57,6 +57,20 @@
 #define DEFAULT_REALTIME_PRIORITY 0
 #endif
 
+#ifndef DEFAULT_WORKER_THREADS
+#define DEFAULT_WORKER_THREADS 1
+#endif
+
+#ifndef DEFAULT_HARDWARE
+#define DEFAULT_HARDWARE "isdn"
+#endif
+
+#ifndef DEFAULT_PTY
+#define DEFAULT_PTY "/dev/ptyp9"
+#endif
+
+#define MAX_WORKER_THREADS 64
+
 #ifndef DEFAULT_COUNTRY
 #define DEFAULT_COUNTRY "47"
 #endif
@@ -73,6 +87,7 @@ char *int_prefix = DEFAULT_INT_PREFIX;
 int watchdog_timeout = DEFAULT_WATCHDOG_TIMEOUT;
 int realtime_priority = DEFAULT_REALTIME_PRIORITY;
 int do_lock_memory = 1;
+int worker_threads = DEFAULT_WORKER_THREADS;
 
 
 #define MAXCFGLINE 128
@@ -199,6 +214,8 @@ static char *get_param_string(char **pp)
 	strncpy(string,start,length);
 	string[length] = '\0';
 
+	*pp = p;
+
 	return string;
 }
 
@@ -215,12 +232,45 @@ static void end_line(char **pp)
   exit(1);
 }
 
+/* Add a new phone line at the end of the list of lines, using the
+ * given hardware driver.
+ */
+
+static struct ModemLine *new_line(char *hardware)
+{
+	struct ModemLine *line, **pp;
+
+	line = ifax_malloc(sizeof(*line),"Modem line");
+	line->number = num_lines++;
+
+	if ( (line->hh=hardware_allocate(hardware)) == 0 ) {
+		fprintf(stderr,"%s: Unknown hw '%s'\n",progname,hardware);
+		exit(1);
+	}
+
+	for ( pp = &lines; *pp != 0; pp = &(*pp)->next )
+		;
+	*pp = line;
+
+	return line;
+}
+
+/* The configuration file may describe several phone lines.  A line is
+ * started by a 'hardware' setting, by the first hardware parameter when
+ * there is no line yet, or by a new 'device' parameter (like
+ * 'isdn-device') when the current line already has one; it then uses
+ * the same type of hardware as the line before it.  The hardware
+ * parameters and 'pty' that follow belong to that line.
+ */
+
 void read_configuration_file(void)
 {
 	FILE *cfg;
 	char *p, *tmp;
 	char buffer[MAXCFGLINE+4];
 	char hwprefix[32], *hardware, *param, *value;
+	struct ModemLine *line = 0, *l;
+	int has_device = 0, is_device;
 
 	if ( (cfg=fopen(config_file,"r")) == 0 ) {
 		fprintf(stderr,"%s: Unable to read config file '%s'\n",
@@ -228,6 +278,10 @@ void read_configuration_file(void)
 		exit(1);
 	}
 
+	hardware = DEFAULT_HARDWARE;
+	strcpy(hwprefix,hardware);
+	strcat(hwprefix,"-");
+
 	for (;;) {
 
 		if ( fgets(buffer,MAXCFGLINE,cfg) == 0 )
@@ -246,36 +300,76 @@ void read_configuration_file(void)
 			hardware = get_string(&p);
 			end_line(&p);
 
-			if ( hh != 0 ) {
-				fprintf(stderr,"%s: Multiple hardware defs\n",
-					progname);
-				exit(1);
-			}
-
-			hh = hardware_allocate(hardware);
-
-			if  ( hh == 0 ) {
+			if ( strlen(hardware) > sizeof(hwprefix) - 2 ) {
 				fprintf(stderr,"%s: Unknown hw '%s'\n",
 					progname,hardware);
 				exit(1);
 			}
 
+			line = new_line(hardware);
+			has_device = 0;
+
 			strcpy(hwprefix,hardware);
 			strcat(hwprefix,"-");
 			continue;
 		}
 
-		if ( hh != 0 && cmd_nmatch(hwprefix,&p,strlen(hwprefix) ) ) {
+		if ( cmd_nmatch(hwprefix,&p,strlen(hwprefix) ) ) {
 			param = get_param_string(&p);
 			skip_assignment(&p);
 			value = get_string(&p);
 			end_line(&p);
-			hh->configure(hh,param,value);
+
+			is_device = !strcmp(param,"device");
+			if ( line == 0 || (is_device && has_device) ) {
+				line = new_line(hardware);
+				has_device = 0;
+			}
+			if ( is_device )
+				has_device = 1;
+
+			line->hh->configure(line->hh,param,value);
+			if ( line->hh->error ) {
+				fprintf(stderr,"%s: %s\n",progname,
+					line->hh->errormsg);
+				exit(1);
+			}
 			free(param);
 			free(value);
 			continue;
 		}
 
+		if ( cmd_match("pty",&p) ) {
+			skip_assignment(&p);
+			value = get_string(&p);
+			end_line(&p);
+			if ( line == 0 ) {
+				fprintf(stderr,"%s: 'pty' before the hardware it belongs to\n",
+					progname);
+				exit(1);
+			}
+			if ( line->pty != 0 ) {
+				fprintf(stderr,"%s: Multiple pty defs for line %d\n",
+					progname,line->number);
+				exit(1);
+			}
+			line->pty = value;
+			continue;
+		}
+
+		if ( cmd_match("worker-threads",&p) ) {
+			skip_assignment(&p);
+			worker_threads = get_int(&p);
+			end_line(&p);
+			if ( worker_threads < 1
+			     || worker_threads > MAX_WORKER_THREADS ) {
+				fprintf(stderr,"%s: Worker threads must be in range 1-%d\n",
+					progname,MAX_WORKER_THREADS);
+				exit(1);
+			}
+			continue;
+		}
+
 		if ( cmd_match("pidfile",&p) ) {
 			skip_assignment(&p);
 			pid_file = get_string(&p);
@@ -357,4 +451,17 @@ void read_configuration_file(void)
 	}
 
 	fclose(cfg);
+
+	/* A single line may use the default pty, all others must be given */
+
+	if ( num_lines == 1 && lines->pty == 0 )
+		lines->pty = DEFAULT_PTY;
+
+	for ( l=lines; l != 0; l = l->next ) {
+		if ( l->pty == 0 ) {
+			fprintf(stderr,"%s: No pty given for line %d\n",
+				progname,l->number);
+			exit(1);
+		}
+	}
 }
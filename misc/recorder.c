@@ -0,0 +1,249 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Recording of calls to file from a background thread.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sched.h>
+#include <signal.h>
+#include <time.h>
+
+#include <ifax/debug.h>
+#include <ifax/misc/malloc.h>
+#include <ifax/misc/recorder.h>
+
+/* How often the thread looks for samples to write (nanoseconds), and
+ * how much it writes at a time.
+ */
+#define RECORDER_POLL	50000000
+#define RECORDER_BLOCK	8192
+
+#define WAV_HEADER	44
+
+
+static void put16(ifax_uint8 *p, unsigned int v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+}
+
+static void put32(ifax_uint8 *p, unsigned long v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+	p[2] = v >> 16;
+	p[3] = v >> 24;
+}
+
+/* The WAV header, for 'bytes' bytes of samples */
+
+static void wav_header(struct Recorder *rec, ifax_uint8 *h,
+		       unsigned long bytes)
+{
+	memcpy(h,"RIFF",4);
+	put32(h+4,bytes + WAV_HEADER - 8);
+	memcpy(h+8,"WAVEfmt ",8);
+	put32(h+16,16);				/* Size of format chunk */
+	put16(h+20,1);				/* PCM */
+	put16(h+22,rec->channels);
+	put32(h+24,rec->rate);
+	put32(h+28,rec->rate * rec->channels * 2);
+	put16(h+32,rec->channels * 2);
+	put16(h+34,16);				/* Bits per sample */
+	memcpy(h+36,"data",4);
+	put32(h+40,bytes);
+}
+
+/* WAV files are little-endian; the samples are swapped if need be */
+
+static void write_block(struct Recorder *rec, ifax_uint8 *block, int size)
+{
+	static const ifax_uint16 one = 1;
+	ifax_uint8 c;
+	int t;
+
+	if ( *(ifax_uint8 *)&one == 0 ) {
+		for ( t=0; t < size; t += 2 ) {
+			c = block[t];
+			block[t] = block[t+1];
+			block[t+1] = c;
+		}
+	}
+
+	/* After a failure (the listener went away, say) the samples
+	 * are taken out of the ring and thrown away, once reported.
+	 */
+	if ( rec->failed )
+		return;
+
+	if ( write(rec->fd,block,size) != size ) {
+		ifax_dprintf(DEBUG_ERROR,"Recorder %s: Write failed: %s\n",
+			     rec->name,strerror(errno));
+		rec->failed = 1;
+		return;
+	}
+
+	rec->written += size / (2 * rec->channels);
+}
+
+static void *recorder_main(void *arg)
+{
+	struct Recorder *rec = arg;
+	ifax_uint8 block[RECORDER_BLOCK];
+	struct timespec poll;
+	sigset_t pipe;
+	int size, done;
+
+	/* A closed socket or pipe fails the write instead */
+	sigemptyset(&pipe);
+	sigaddset(&pipe,SIGPIPE);
+	pthread_sigmask(SIG_BLOCK,&pipe,0);
+
+	poll.tv_sec = 0;
+	poll.tv_nsec = RECORDER_POLL;
+
+	for (;;) {
+		/* Seen before draining, so nothing queued is left behind */
+		done = rec->stop;
+
+		while ( (size=ioring_drain(rec->ring,block,sizeof(block))) > 0 )
+			write_block(rec,block,size);
+
+		if ( done )
+			break;
+
+		nanosleep(&poll,0);
+	}
+
+	return 0;
+}
+
+
+struct Recorder *recorder_attach(int fd, char *name, int channels, int rate)
+{
+	struct Recorder *rec;
+	struct sched_param schedparams;
+	pthread_attr_t attr;
+	int rc;
+
+	rec = ifax_malloc(sizeof(*rec),"Recorder");
+	rec->fd = fd;
+	rec->channels = channels;
+	rec->rate = rate;
+	strncpy(rec->name,name,sizeof(rec->name)-1);
+
+	rec->ring = ioring_allocate(RECORDER_RING,"Recorder");
+
+	/* Not real-time, even if started from a thread that is */
+
+	pthread_attr_init(&attr);
+	schedparams.sched_priority = 0;
+	pthread_attr_setinheritsched(&attr,PTHREAD_EXPLICIT_SCHED);
+	pthread_attr_setschedpolicy(&attr,SCHED_OTHER);
+	pthread_attr_setschedparam(&attr,&schedparams);
+
+	rc = pthread_create(&rec->thread,&attr,recorder_main,rec);
+	pthread_attr_destroy(&attr);
+
+	if ( rc != 0 ) {
+		ifax_dprintf(DEBUG_ERROR,"Recorder %s: Unable to start thread\n",
+			     name);
+		close(fd);
+		free(rec->ring->data);
+		free(rec->ring);
+		free(rec);
+		return 0;
+	}
+
+	return rec;
+}
+
+struct Recorder *recorder_start(char *name, int channels, int rate)
+{
+	struct Recorder *rec;
+	ifax_uint8 header[WAV_HEADER];
+	int fd;
+
+	if ( (fd = creat(name,0660)) < 0 ) {
+		ifax_dprintf(DEBUG_ERROR,"Recorder %s: %s\n",name,
+			     strerror(errno));
+		return 0;
+	}
+
+	if ( (rec = recorder_attach(fd,name,channels,rate)) == 0 )
+		return 0;
+
+	/* The sizes are filled in when the recording stops; the thread
+	 * doesn't write anything before it is given samples.
+	 */
+	rec->wav = 1;
+	wav_header(rec,header,0);
+	write(fd,header,WAV_HEADER);
+
+	return rec;
+}
+
+int recorder_write(struct Recorder *rec, ifax_sint16 *samples, int frames)
+{
+	int size = frames * rec->channels * sizeof(ifax_sint16);
+
+	if ( ioring_fill(rec->ring,samples,size) != size ) {
+		rec->dropped += frames;
+		return 1;
+	}
+
+	return 0;
+}
+
+void recorder_stop(struct Recorder *rec)
+{
+	ifax_uint8 header[WAV_HEADER];
+	unsigned long bytes;
+
+	rec->stop = 1;
+	pthread_join(rec->thread,0);
+
+	/* Not possible if the file is a pipe, say */
+	if ( rec->wav ) {
+		bytes = rec->written * rec->channels * 2;
+		wav_header(rec,header,bytes);
+		if ( lseek(rec->fd,0,SEEK_SET) == 0 )
+			write(rec->fd,header,WAV_HEADER);
+	}
+
+	ifax_dprintf(DEBUG_INFO,"Recorder %s: %lu frames written, "
+		     "%lu dropped\n",rec->name,rec->written,rec->dropped);
+
+	close(rec->fd);
+	free(rec->ring->data);
+	free(rec->ring);
+	free(rec);
+}
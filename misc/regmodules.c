@@ -45,6 +45,9 @@
 #include <ifax/modules/V.29_demod.h>
 #include <ifax/modules/replicate.h>
 #include <ifax/modules/hdlc-framing.h>
+#include <ifax/modules/bank.h>
+#include <ifax/modules/channel.h>
+#include <ifax/modules/monitor.h>
 
 /* FIXME: The following should be in header-files */
 extern int send_to_audio_construct (ifax_modp self, va_list args);
@@ -81,6 +84,11 @@ ifax_module_id IFAX_LINEDRIVER;
 ifax_module_id IFAX_SIGNALGEN;
 ifax_module_id IFAX_V29DEMOD;
 ifax_module_id IFAX_ENCODER_HDLC;
+ifax_module_id IFAX_FSKDEMOD_BANK;
+ifax_module_id IFAX_MODULATORV21_BANK;
+ifax_module_id IFAX_RATECONVERT_BANK;
+ifax_module_id IFAX_CHANNEL;
+ifax_module_id IFAX_MONITOR;
 
 
 #define REGMODULE(m,d,c) m=ifax_register_module_class(d,c)
@@ -106,4 +114,12 @@ void register_modules(void)
   REGMODULE(IFAX_LINEDRIVER,"Linedriver",linedriver_construct);
   REGMODULE(IFAX_V29DEMOD,"V.29 Demodulator",V29demod_construct);
   REGMODULE(IFAX_ENCODER_HDLC,"HDLC encoder",encoder_hdlc_construct);
+  REGMODULE(IFAX_FSKDEMOD_BANK,"FSK demodulator bank",
+	    fskdemod_bank_construct);
+  REGMODULE(IFAX_MODULATORV21_BANK,"V.21 Modulator bank",
+	    modulator_V21_bank_construct);
+  REGMODULE(IFAX_RATECONVERT_BANK,"Samplerate converter bank",
+	    rateconvert_bank_construct);
+  REGMODULE(IFAX_CHANNEL,"Channel simulator",channel_construct);
+  REGMODULE(IFAX_MONITOR,"Monitor",monitor_construct);
 }
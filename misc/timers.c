@@ -43,6 +43,7 @@
 
 #include <ifax/misc/timers.h>
 #include <ifax/misc/softsignals.h>
+#include <ifax/misc/eventloop.h>
 
 static struct {
 	ifax_sint32 current_value;
@@ -91,6 +92,10 @@ void hard_timer_init(hard_timer_t *ht, ifax_uint32 sec, ifax_uint32 usec)
 		ht->expires.tv_sec++;
 		ht->expires.tv_usec -= 1000000;
 	}
+
+	/* Whoever is waiting for the timer must be woken up to see it */
+	if ( eventloop_current != 0 )
+		eventloop_deadline(eventloop_current,&ht->expires);
 }
 
 int hard_timer_expired(hard_timer_t *ht)
@@ -99,14 +104,18 @@ int hard_timer_expired(hard_timer_t *ht)
 
 	gettimeofday(&now,(struct timezone *)0);
 
-	if ( now.tv_sec < ht->expires.tv_sec )
-		return 0;
-
 	if ( now.tv_sec > ht->expires.tv_sec )
 		return 1;
 
-	if ( now.tv_usec >= ht->expires.tv_usec )
+	if ( now.tv_sec == ht->expires.tv_sec
+	     && now.tv_usec >= ht->expires.tv_usec )
 		return 1;
 
+	/* Only one deadline is kept by the event loop, so the timer is
+	 * registered again in case another one took its place.
+	 */
+	if ( eventloop_current != 0 )
+		eventloop_deadline(eventloop_current,&ht->expires);
+
 	return 0;
 }
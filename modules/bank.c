@@ -0,0 +1,129 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Common code for multi-channel (bank) modules.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+/* The bank modules (see <ifax/modules/bank.h>) keep their channel
+ * bookkeeping in an 'ifax_bank' structure, and use the functions here
+ * to handle the commands and output common to all of them.
+ */
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ifax/ifax.h>
+#include <ifax/misc/malloc.h>
+#include <ifax/modules/bank.h>
+
+
+void bank_initialize(ifax_bank *bank, int channels)
+{
+  bank->channels = channels;
+  bank->routed = 0;
+  bank->sendto = ifax_malloc(sizeof(*bank->sendto)*channels,
+			     "Bank channel destinations");
+  bank->scratch = 0;
+  bank->scratch_size = 0;
+}
+
+void bank_destroy(ifax_bank *bank)
+{
+  free(bank->sendto);
+  if ( bank->scratch != 0 )
+    free(bank->scratch);
+}
+
+/* Returns 1 if the command is not a bank command */
+
+int bank_command(ifax_bank *bank, int cmd, va_list cmds)
+{
+  ifax_modp dst;
+  int channel;
+
+  switch ( cmd ) {
+
+    case CMD_BANK_CHANNELS:
+      return bank->channels;
+
+    case CMD_BANK_SENDTO:
+      channel = va_arg(cmds,int);
+      dst = va_arg(cmds,ifax_modp);
+      if ( channel < 0 || channel >= bank->channels )
+	return 1;
+      if ( bank->sendto[channel] != 0 )
+	bank->routed--;
+      if ( dst != 0 )
+	bank->routed++;
+      bank->sendto[channel] = dst;
+      break;
+
+    default:
+      return 1;
+  }
+
+  return 0;
+}
+
+/* Channels with a destination of their own get their part of the
+ * interleaved output picked out and sent there.  The rest is sent on
+ * interleaved as it is, if there is somewhere to send it.
+ */
+
+void bank_output(ifax_modp self, ifax_bank *bank, void *data,
+		 size_t frames, size_t unit)
+{
+  ifax_uint8 *src, *dst;
+  size_t framesize = unit * bank->channels;
+  size_t f;
+  int c;
+
+  if ( frames == 0 )
+    return;
+
+  if ( bank->routed > 0 ) {
+
+    if ( bank->scratch_size < frames*unit ) {
+      if ( bank->scratch != 0 )
+	free(bank->scratch);
+      bank->scratch_size = frames*unit;
+      bank->scratch = ifax_malloc(bank->scratch_size,"Bank output");
+    }
+
+    for ( c=0; c < bank->channels; c++ ) {
+      if ( bank->sendto[c] == 0 )
+	continue;
+      src = (ifax_uint8 *)data + c*unit;
+      dst = bank->scratch;
+      for ( f=0; f < frames; f++ ) {
+	memcpy(dst,src,unit);
+	dst += unit;
+	src += framesize;
+      }
+      ifax_handle_input(bank->sendto[c],bank->scratch,frames);
+    }
+  }
+
+  if ( self->sendto != 0 )
+    ifax_handle_input(self->sendto,data,frames);
+}
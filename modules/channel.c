@@ -0,0 +1,391 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Telephone channel simulator; adds noise, echo, frequency offset etc.
+  
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+/* The channel simulator is put in front of a demodulator to see how it
+ * copes with a less than perfect phone line.  The impairments are
+ * applied in the order they are listed below, all of them off to begin
+ * with:
+ *
+ *   Attenuation:  The signal is weakened by a number of dB.
+ *   Echo:         A delayed and attenuated copy is added to the signal.
+ *   Frequency:    The whole spectrum is shifted by an offset, and the
+ *                 phase may jitter sinusoidally (as from the power
+ *                 line hum on an analog carrier system).
+ *   Noise:        White gaussian noise at a given level.
+ *   A-law:        The result is quantized like on an ISDN line.
+ *
+ * The noise level is given in dBm0, where a 0 dBm0 sine is 3.14 dB
+ * below the largest A-law value.  The signal to noise ratio is the
+ * level of the signal minus this.
+ *
+ * The noise is made by a pseudo random generator of its own, so a run
+ * can be repeated exactly by giving the same seed.
+ *
+ * The module interface is:
+ *
+ *    Input and Output:
+ *       - 16-bit signed samples
+ *       - length specifies number of samples
+ *
+ *    Commands supported:
+ *       CMD_GENERIC_INITIALIZE          (back to a clean channel)
+ *       CMD_CHANNEL_ATTENUATION,dB
+ *       CMD_CHANNEL_ECHO,delay,dB       (delay in samples, 0 for off)
+ *       CMD_CHANNEL_FREQOFFSET,offset   (in 1/10 Hz)
+ *       CMD_CHANNEL_JITTER,freq,peak    (in Hz and degrees)
+ *       CMD_CHANNEL_NOISE,level         (in dBm0, -100 or less for off)
+ *       CMD_CHANNEL_ALAW,on
+ *       CMD_CHANNEL_SEED,seed
+ *
+ *    Parameters:
+ *       None
+ */
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <ifax/ifax.h>
+#include <ifax/alaw.h>
+#include <ifax/misc/malloc.h>
+#include <ifax/modules/generic.h>
+#include <ifax/modules/channel.h>
+
+#define PI		3.14159265358979323846
+#define SAMPLERATE	8000
+
+/* RMS value of a 0 dBm0 sine, in the scale used for samples */
+#define DBM0_RMS	15889.0
+
+/* The frequency shift needs the Hilbert transform of the signal.  It
+ * is made by an FIR filter of this length, and the signal itself is
+ * delayed by half of it to line up.
+ */
+#define HILBERT_TAPS	63
+#define HILBERT_DELAY	(HILBERT_TAPS/2)
+
+typedef struct {
+
+  double gain;                  /* From attenuation */
+
+  int echo_delay;               /* 0 for no echo */
+  double echo_gain;
+  double *echo;                 /* Past samples, CHANNEL_MAXECHO of them */
+  int echo_pos;
+
+  int shift;                    /* Nonzero if frequency/phase is moved */
+  double offset_inc, offset_phase;
+  double jitter_inc, jitter_phase, jitter_peak;
+  double hilbert[HILBERT_TAPS];
+  double history[2*HILBERT_TAPS];       /* Stored twice to avoid wrapping */
+  int history_pos;
+
+  double noise;                 /* RMS of noise, 0 for none */
+  ifax_uint32 seed;
+  int have_spare;
+  double spare;
+
+  int alaw;
+
+} channel_private;
+
+
+/* Uniformly distributed numbers in (0,1] (xorshift generator) */
+
+static double uniform(channel_private *priv)
+{
+  ifax_uint32 x = priv->seed;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  priv->seed = x;
+
+  return (x + 1.0) / 4294967296.0;
+}
+
+/* Gaussian numbers with unit variance (Box-Muller), made in pairs */
+
+static double gaussian(channel_private *priv)
+{
+  double r, a;
+
+  if ( priv->have_spare ) {
+    priv->have_spare = 0;
+    return priv->spare;
+  }
+
+  r = sqrt(-2.0 * log(uniform(priv)));
+  a = 2.0 * PI * uniform(priv);
+
+  priv->spare = r * sin(a);
+  priv->have_spare = 1;
+
+  return r * cos(a);
+}
+
+static void clean_channel(channel_private *priv)
+{
+  priv->gain = 1.0;
+  priv->echo_delay = 0;
+  priv->shift = 0;
+  priv->offset_inc = priv->jitter_inc = priv->jitter_peak = 0.0;
+  priv->offset_phase = priv->jitter_phase = 0.0;
+  priv->noise = 0.0;
+  priv->alaw = 0;
+
+  memset(priv->echo,0,CHANNEL_MAXECHO*sizeof(double));
+  memset(priv->history,0,sizeof(priv->history));
+}
+
+/* Run 'length' samples through the channel.  Each input sample is read
+ * before the output sample is written, so 'in' and 'out' may be the
+ * same buffer.
+ */
+
+static void channel_filter(channel_private *priv, ifax_sint16 *in,
+			   size_t length, ifax_sint16 *out)
+{
+  double x, xh, theta, *h;
+  ifax_sint16 s;
+  size_t t;
+  int k;
+
+  for ( t=0; t < length; t++ ) {
+
+    x = in[t] * priv->gain;
+
+    if ( priv->echo_delay > 0 ) {
+      priv->echo[priv->echo_pos] = x;
+      x += priv->echo_gain * priv->echo[(priv->echo_pos - priv->echo_delay)
+					 & (CHANNEL_MAXECHO-1)];
+      priv->echo_pos = (priv->echo_pos + 1) & (CHANNEL_MAXECHO-1);
+    }
+
+    if ( priv->shift ) {
+      /* Newest sample last in the history; every other tap is zero */
+      priv->history[priv->history_pos] = x;
+      priv->history[priv->history_pos + HILBERT_TAPS] = x;
+      if ( ++priv->history_pos >= HILBERT_TAPS )
+	priv->history_pos = 0;
+
+      h = &priv->history[priv->history_pos];
+      xh = 0.0;
+      for ( k=(HILBERT_DELAY+1)&1; k < HILBERT_TAPS; k += 2 )
+	xh += priv->hilbert[k] * h[k];
+      x = h[HILBERT_DELAY];
+
+      theta = priv->offset_phase
+	+ priv->jitter_peak * sin(priv->jitter_phase);
+      x = x * cos(theta) - xh * sin(theta);
+
+      priv->offset_phase += priv->offset_inc;
+      if ( priv->offset_phase > PI )
+	priv->offset_phase -= 2*PI;
+      if ( priv->offset_phase < -PI )
+	priv->offset_phase += 2*PI;
+      priv->jitter_phase += priv->jitter_inc;
+      if ( priv->jitter_phase > PI )
+	priv->jitter_phase -= 2*PI;
+    }
+
+    if ( priv->noise > 0.0 )
+      x += priv->noise * gaussian(priv);
+
+    if ( x >= 32767.0 )
+      s = 32767;
+    else if ( x <= -32768.0 )
+      s = -32768;
+    else
+      s = (ifax_sint16) floor(x + 0.5);
+
+    if ( priv->alaw )
+      s = 8 * wala2sint[sint2wala[((ifax_uint16) s) >> 4]];
+
+    out[t] = s;
+  }
+}
+
+static int channel_handle(ifax_modp self, void *data, size_t length)
+{
+  channel_private *priv = self->private;
+  size_t chunk, remaining = length;
+  ifax_sint16 *src = data;
+  ifax_buffer *buf;
+
+  while ( remaining > 0 ) {
+    chunk = remaining;
+    if ( chunk > IFAX_BUFFER_SAMPLES )
+      chunk = IFAX_BUFFER_SAMPLES;
+    if ( (buf = ifax_buffer_alloc(IFAX_FORMAT_S16,chunk)) == 0 )
+      break;
+    channel_filter(priv,src,chunk,buf->data);
+    ifax_handle_buffer(self->sendto,buf);
+    src += chunk;
+    remaining -= chunk;
+  }
+
+  return length;
+}
+
+static int channel_handle_buffer(ifax_modp self, ifax_buffer *buf)
+{
+  channel_private *priv = self->private;
+  size_t length = buf->length;
+
+  if ( (buf = ifax_buffer_writable(buf)) == 0 )
+    return 0;
+
+  channel_filter(priv,buf->data,length,buf->data);
+  ifax_handle_buffer(self->sendto,buf);
+
+  return length;
+}
+
+static size_t channel_process(ifax_modp self, void *in, size_t length,
+			      void *out)
+{
+  channel_filter(self->private,in,length,out);
+
+  return length;
+}
+
+static size_t channel_max(ifax_modp self, size_t length)
+{
+  return length;
+}
+
+static void channel_demand(ifax_modp self, size_t demand)
+{
+  ifax_handle_demand(self->recvfrom,demand);
+}
+
+static int channel_command(ifax_modp self, int cmd, va_list cmds)
+{
+  channel_private *priv = self->private;
+  int a, b;
+
+  switch ( cmd ) {
+
+    case CMD_GENERIC_INITIALIZE:
+      clean_channel(priv);
+      break;
+
+    case CMD_CHANNEL_ATTENUATION:
+      a = va_arg(cmds,int);
+      priv->gain = pow(10.0,-a/20.0);
+      break;
+
+    case CMD_CHANNEL_ECHO:
+      a = va_arg(cmds,int);
+      b = va_arg(cmds,int);
+      if ( a < 0 || a >= CHANNEL_MAXECHO )
+	return 1;
+      priv->echo_delay = a;
+      priv->echo_gain = pow(10.0,-b/20.0);
+      break;
+
+    case CMD_CHANNEL_FREQOFFSET:
+      a = va_arg(cmds,int);
+      priv->offset_inc = 2*PI * a / 10.0 / SAMPLERATE;
+      priv->shift = priv->offset_inc != 0.0 || priv->jitter_peak != 0.0;
+      break;
+
+    case CMD_CHANNEL_JITTER:
+      a = va_arg(cmds,int);
+      b = va_arg(cmds,int);
+      priv->jitter_inc = 2*PI * a / SAMPLERATE;
+      priv->jitter_peak = b * PI / 180.0;
+      priv->shift = priv->offset_inc != 0.0 || priv->jitter_peak != 0.0;
+      break;
+
+    case CMD_CHANNEL_NOISE:
+      a = va_arg(cmds,int);
+      priv->noise = a <= -100 ? 0.0 : DBM0_RMS * pow(10.0,a/20.0);
+      break;
+
+    case CMD_CHANNEL_ALAW:
+      priv->alaw = va_arg(cmds,int);
+      break;
+
+    case CMD_CHANNEL_SEED:
+      priv->seed = va_arg(cmds,int);
+      if ( priv->seed == 0 )
+	priv->seed = 1;
+      priv->have_spare = 0;
+      break;
+
+    default:
+      return 1;
+  }
+
+  return 0;
+}
+
+static void channel_destroy(ifax_modp self)
+{
+  channel_private *priv = self->private;
+
+  free(priv->echo);
+  free(priv);
+}
+
+int channel_construct(ifax_modp self, va_list args)
+{
+  channel_private *priv;
+  int k;
+
+  priv = ifax_malloc(sizeof(channel_private),"Channel simulator instance");
+  priv->echo = ifax_malloc(CHANNEL_MAXECHO*sizeof(double),"Channel echo");
+  self->private = priv;
+
+  self->destroy = channel_destroy;
+  self->handle_input = channel_handle;
+  self->handle_buffer = channel_handle_buffer;
+  self->handle_demand = channel_demand;
+  self->command = channel_command;
+  self->process = channel_process;
+  self->process_max = channel_max;
+  self->input_format = IFAX_FORMAT_S16;
+  self->output_format = IFAX_FORMAT_S16;
+
+  /* Hilbert transformer, 2/(pi*n) for odd n, with a Hamming window.
+   * Tap 0 is the oldest sample.
+   */
+  for ( k=0; k < HILBERT_TAPS; k++ ) {
+    if ( (k - HILBERT_DELAY) & 1 )
+      priv->hilbert[k] = 2.0 / (PI * (HILBERT_DELAY - k))
+	* (0.54 - 0.46 * cos(2*PI * k / (HILBERT_TAPS-1)));
+    else
+      priv->hilbert[k] = 0.0;
+  }
+
+  priv->seed = 1;
+  clean_channel(priv);
+
+  return 0;
+}
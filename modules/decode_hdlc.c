@@ -35,6 +35,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
 #include <sys/times.h>
 #include <ifax/ifax.h>
 #include <ifax/modules/decode_hdlc.h>
@@ -43,42 +44,328 @@
 #define _HDLC_STUFFMASK (0x3f)
 #define _HDLC_STUFF     (0x3e)
 
-#define _CRC_INIT    0xffff
-#define _CRC_TOPMASK 0x8000
-#define _CRC_POLY    0x1021
-#define _CRC_GOOD    0x1d0f
+/* The de-stuffed bytes of a frame are collected, and the CRC is
+ * checked over all of them when the closing flag arrives.  The bytes
+ * are kept in the order they were sent (LSB first), which is the
+ * reverse of how they are shifted in here.  Should a frame not fit,
+ * the CRC is run over what there is, and collecting starts over.
+ */
+#define _FRAME_MAX	512
+
+/* In packed mode, the input is run through a table that takes a whole
+ * byte of bits at a time: For each number of ones in a row before it
+ * (0-6, or 7 for an abort that is still going on) and each value of
+ * the byte, the table gives the de-stuffed data bits and the number of
+ * ones after it.  Should there be a flag or an abort in the byte, the
+ * table gives the data bits before it, which it was and where it ended,
+ * and the rest of the byte is done a bit at a time.
+ *
+ * Table entries are packed like this:
+ */
+#define _T_DATA(e)	((e)&0xff)		/* Data bits, first in bit 0 */
+#define _T_COUNT(e)	(((e)>>8)&0xf)		/* Number of data bits */
+#define _T_ONES(e)	(((e)>>12)&0x7)		/* Ones in a row after */
+#define _T_EVENT(e)	(((e)>>16)&0x3)		/* _EV_* */
+#define _T_POS(e)	(((e)>>20)&0x7)		/* Bit ending the event */
+
+#define _EV_NONE	0
+#define _EV_FLAG	1
+#define _EV_ABORT	2
+
+/* Finished frames wait in a queue until they are fetched with
+ * CMD_DECODE_HDLC_GETFRAME.  A frame is built in place at the end of
+ * the queue, and is dropped if the queue is full when it is done.
+ */
+#define _QUEUE_SIZE	16
+
+typedef struct {
+	int		status;		/* HDLC_CRC_OK, HDLC_CRC_ERR or HDLC_ABORT */
+	size_t		length;
+	ifax_uint8	data[_FRAME_MAX];
+} decode_hdlc_frame;
+
+typedef struct {
+
+	int	ones;			/* Table state */
+	int	hunting;		/* Waiting for a flag */
+	ifax_uint32	acc;		/* Data bits not yet a whole byte */
+	int	accbits;
+
+	decode_hdlc_frame	queue[_QUEUE_SIZE];
+	int	head, tail;		/* Frames are fetched from 'head' */
+
+} decode_hdlc_deframer;
 
 typedef struct {
 
 	int	syncbitcnt;
 	int	bits;
-	int 	have_stuffed;
+	int	line;
 
 	ifax_uint16	crc;
+	size_t		framelen;
+	ifax_uint8	frame[_FRAME_MAX];
+
+	decode_hdlc_deframer	*deframer;	/* Packed mode only */
 
 } decode_hdlc_private;
 
+static ifax_uint32 deframe_table[8][256];
+static int deframe_table_ready=0;
+
 /* Free the private data
  */
 void	decode_hdlc_destroy(ifax_modp self)
 {
-	/*decode_hdlc_private *priv=(decode_hdlc_private *)self->private;*/
+	decode_hdlc_private *priv=(decode_hdlc_private *)self->private;
 
+	if (priv->deframer)
+		free(priv->deframer);
 	free(self->private);
 
 	return;
 }
 
-int	decode_hdlc_command(ifax_modp self,int cmd,va_list cmds)
+/* What a bit on the line does after 'ones' ones in a row.  Returns the
+ * new number of ones, and sets '*data' to the data bit, or -1 if it is
+ * not one, and '*event' to the _EV_* it ends.
+ */
+static int	line_bit(int ones,int bit,int *data,int *event)
 {
-	return 0;	/* Not yet used. */
+	*data=-1;
+	*event=_EV_NONE;
+
+	if (bit) {
+		if (ones<5)
+			*data=1;
+		else if (ones==6)
+			*event=_EV_ABORT;
+		return ones<7 ? ones+1 : 7;
+	}
+
+	if (ones==6)
+		*event=_EV_FLAG;
+	else if (ones!=5)	/* After five ones it is stuffed */
+		*data=0;
+	return 0;
+}
+
+static void	build_deframe_table(void)
+{
+	int ones,byte,pos,state,data,event,count;
+	ifax_uint32 bits;
+
+	for(ones=0;ones<8;ones++)
+		for(byte=0;byte<256;byte++)
+		{
+			state=ones;
+			bits=0;
+			count=0;
+			event=_EV_NONE;
+			for(pos=0;pos<8;pos++)
+			{
+				state=line_bit(state,(byte>>pos)&1,&data,&event);
+				if (data>=0)
+					bits|=data<<count++;
+				if (event!=_EV_NONE)
+					break;
+			}
+			deframe_table[ones][byte]=bits | (count<<8) | (state<<12)
+				| (event<<16) | ((pos&7)<<20);
+		}
+	deframe_table_ready=1;
+}
+
+/* A frame has ended with a flag.  The first five ones and the zero in
+ * front of the flag have been taken for data bits, so a frame made of
+ * whole bytes leaves six bits behind.  Frames of less than three bytes
+ * are taken to be noise and dropped.
+ */
+static void	deframe_flag(decode_hdlc_deframer *df)
+{
+	decode_hdlc_frame *frame=&df->queue[df->tail];
+	int next;
+
+	if (!df->hunting && frame->length>=3)
+	{
+		next=(df->tail+1)%_QUEUE_SIZE;
+		if (df->accbits!=6 || !ifax_crc16_check(frame->data,frame->length))
+			frame->status=HDLC_CRC_ERR;
+		else
+			frame->status=HDLC_CRC_OK;
+		frame->length-=2;
+		ifax_dprintf(DEBUG_DEBUG,"HDLC frame of %d bytes, CRC %s\n",
+			     (int)frame->length,
+			     frame->status==HDLC_CRC_OK ? "good" : "error");
+		if (next!=df->head)
+			df->tail=next;
+		else
+			ifax_dprintf(DEBUG_WARNING,"HDLC frame queue full\n");
+	}
+
+	df->queue[df->tail].length=0;
+	df->hunting=0;
+	df->acc=0;
+	df->accbits=0;
+}
+
+/* Seven ones or more: The frame is aborted, and queued as such if
+ * anything of it was received.  Nothing more is taken until a flag.
+ */
+static void	deframe_abort(decode_hdlc_deframer *df)
+{
+	decode_hdlc_frame *frame=&df->queue[df->tail];
+	int next=(df->tail+1)%_QUEUE_SIZE;
+
+	if (!df->hunting && frame->length>0)
+	{
+		ifax_dprintf(DEBUG_DEBUG,"HDLC frame aborted\n");
+		frame->status=HDLC_ABORT;
+		if (next!=df->head)
+			df->tail=next;
+	}
+
+	df->queue[df->tail].length=0;
+	df->hunting=1;
+}
+
+/* Up to 8 data bits, first in bit 0 */
+static void	deframe_data(decode_hdlc_deframer *df,ifax_uint32 bits,int count)
+{
+	decode_hdlc_frame *frame;
+
+	df->acc|=bits<<df->accbits;
+	df->accbits+=count;
+	if (df->accbits<8)
+		return;
+
+	if (!df->hunting)
+	{
+		frame=&df->queue[df->tail];
+		if (frame->length<_FRAME_MAX)
+			frame->data[frame->length++]=df->acc&0xff;
+		else
+		{
+			ifax_dprintf(DEBUG_WARNING,"HDLC frame too long\n");
+			df->hunting=1;
+		}
+	}
+	df->acc>>=8;
+	df->accbits-=8;
+}
+
+static void	deframe_event(decode_hdlc_deframer *df,int event)
+{
+	if (event==_EV_FLAG)
+		deframe_flag(df);
+	else
+		deframe_abort(df);
+}
+
+static void	deframe_bits(decode_hdlc_deframer *df,int bits,int count)
+{
+	int data,event;
+
+	while(count--)
+	{
+		df->ones=line_bit(df->ones,bits&1,&data,&event);
+		bits>>=1;
+		if (data>=0)
+			deframe_data(df,data,1);
+		if (event!=_EV_NONE)
+			deframe_event(df,event);
+	}
+}
+
+/* Packed bits, 8 to a byte with the first in bit 0, as made by the
+ * HDLC encoder.  The length is in bits.
+ */
+int	decode_hdlc_handle_packed(ifax_modp self, void *data, size_t length)
+{
+	decode_hdlc_private *priv=(decode_hdlc_private *)self->private;
+	decode_hdlc_deframer *df=priv->deframer;
+	decode_hdlc_frame *frame;
+	ifax_uint8 *src=data;
+	size_t bytes=length>>3;
+	ifax_uint32 e,acc;
+	int ones,accbits,pos;
+
+	while(bytes>0)
+	{
+		/* The bytes inside a frame are done here, with the state
+		 * kept in local variables.  Anything else is left to the
+		 * functions above, one byte at a time.
+		 */
+		frame=&df->queue[df->tail];
+		ones=df->ones;
+		acc=df->acc;
+		accbits=df->accbits;
+		while(bytes>0 && !df->hunting && frame->length<_FRAME_MAX)
+		{
+			e=deframe_table[ones][*src];
+			if (_T_EVENT(e)!=_EV_NONE)
+				break;
+			ones=_T_ONES(e);
+			acc|=_T_DATA(e)<<accbits;
+			accbits+=_T_COUNT(e);
+			if (accbits>=8)
+			{
+				frame->data[frame->length++]=acc&0xff;
+				acc>>=8;
+				accbits-=8;
+			}
+			src++;
+			bytes--;
+		}
+		df->ones=ones;
+		df->acc=acc;
+		df->accbits=accbits;
+		if (bytes==0)
+			break;
+
+		e=deframe_table[df->ones][*src];
+		df->ones=_T_ONES(e);
+		deframe_data(df,_T_DATA(e),_T_COUNT(e));
+		if (_T_EVENT(e)!=_EV_NONE)
+		{
+			deframe_event(df,_T_EVENT(e));
+			pos=_T_POS(e)+1;
+			deframe_bits(df,*src>>pos,8-pos);
+		}
+		src++;
+		bytes--;
+	}
+
+	if (length&7)
+		deframe_bits(df,*src,length&7);
+
+	return length;
+}
+
+static int	fetch_frame(decode_hdlc_deframer *df,ifax_uint8 *dst,size_t size,
+			    int *status)
+{
+	decode_hdlc_frame *frame;
+
+	if (df->head==df->tail)
+		return -1;
+
+	frame=&df->queue[df->head];
+	if (size>frame->length)
+		size=frame->length;
+	memcpy(dst,frame->data,size);
+	if (status)
+		*status=frame->status;
+	df->head=(df->head+1)%_QUEUE_SIZE;
+
+	return size;
 }
 
 int	decode_hdlc_handle(ifax_modp self, void *data, size_t length)
 {
 	char *dat=data;
 	int currbit;
-	int handled,x;
+	int handled;
 	ifax_uint16 result;
 	
 	decode_hdlc_private *priv=(decode_hdlc_private *)self->private;
@@ -89,19 +376,22 @@ int	decode_hdlc_handle(ifax_modp self, void *data, size_t length)
 		currbit =*dat++;
 		ifax_dprintf(DEBUG_DEBUG,"Bit %d is %d\n",priv->syncbitcnt,currbit);
 
-		/* Shift buffer up, place bit into buffer. 
+		/* The bits are looked at as they came on the line for
+		 * flags and stuffing, and the data bits are collected
+		 * in a buffer of their own.
 		 */
-		priv->bits<<=1;
-		priv->bits|=!!currbit;
-		priv->syncbitcnt++;
+		priv->line<<=1;
+		priv->line|=!!currbit;
 
 		/* Check if we have a flag sequence. If yes, check CRC of the
 		 * previous block, send the appropriate code, and then a FLAG
 		 * code. Reset bitcounter and CRC calc field.
 		 */
-		if ((priv->bits&0xff)==_HDLC_FLAG)
+		if ((priv->line&0xff)==_HDLC_FLAG)
 		{
-			result= (priv->crc == _CRC_GOOD) ? 
+			priv->crc=ifax_crc16_update(priv->crc,priv->frame,
+						    priv->framelen);
+			result= (priv->crc == IFAX_CRC16_GOOD) ? 
 				HDLC_CRC_OK : HDLC_CRC_ERR;
 			if (self->sendto)
 				ifax_handle_input(self->sendto,&result,1);
@@ -113,57 +403,99 @@ int	decode_hdlc_handle(ifax_modp self, void *data, size_t length)
 			ifax_dprintf(DEBUG_DEBUG,"HDLC FLAG\n");
 
 			priv->syncbitcnt=0;
-			priv->crc=_CRC_INIT;
-			priv->have_stuffed=0;
+			priv->crc=IFAX_CRC16_INIT;
+			priv->framelen=0;
 		} 
 		/* Check, if bit-stuffing occured. If we received a pattern of
-		 * 111110, the 0 is "stuffed" in. we remove it and flag that
-		 * we have done it to avoid doing that over and over again if
-		 * more zeroes follow.
+		 * 111110, the 0 is "stuffed" in. We remove it.  It has to
+		 * be looked for among the bits on the line, as the data
+		 * may well have five ones followed by a zero.
 		 */
-		else if (!priv->have_stuffed &&(priv->bits&_HDLC_STUFFMASK)==_HDLC_STUFF)
+		else if ((priv->line&_HDLC_STUFFMASK)==_HDLC_STUFF)
 		{
 			/* We don't mention this on the stream. */
 			ifax_dprintf(DEBUG_DEBUG,"Stuffbit removed !\n");
-			priv->bits>>=1;
-			priv->syncbitcnt--;
-			priv->have_stuffed=1;
 		} 
-		/* Do we have a complete byte (don't check this, if stuffing 
-		 * occured - we are still in the same byte, then.
+		/* Shift buffer up, place bit into buffer, and see if we
+		 * have a complete byte.
 		 */
-		else if ((priv->syncbitcnt&7)==0)
+		else
 		{
-			/* Calculate the CRC.
-			 */
-			for(x=7;x>=0;x--)
+			priv->bits<<=1;
+			priv->bits|=!!currbit;
+			if ((++priv->syncbitcnt&7)==0)
 			{
-				if (!(priv->crc&_CRC_TOPMASK) !=
-				    !(priv->bits&(1<<x))) 
-				{ 
-					priv->crc<<=1;
-					priv->crc^=_CRC_POLY;
+				/* Keep the byte for the CRC check.
+				 */
+				if (priv->framelen==_FRAME_MAX)
+				{
+					priv->crc=ifax_crc16_update(priv->crc,
+								    priv->frame,
+								    priv->framelen);
+					priv->framelen=0;
 				}
-				else
-					priv->crc<<=1;
-				ifax_dprintf(DEBUG_JUNK,"CRC %04x\n",priv->crc);
+				priv->frame[priv->framelen++]=
+					bitreverse[priv->bits&0xff];
+				/* mask out the result and transmit it.
+				 */
+				result=priv->bits&0xff;
+				if (self->sendto)
+					ifax_handle_input(self->sendto,&result,1);
+				ifax_dprintf(DEBUG_DEBUG,"HDLC %x\n",priv->bits&0xff);
 			}
-			/* We have to reset the bitstuffing flag in all 
-			 * non-stuffing cases ...
-			 */
-			priv->have_stuffed=0;
-			/* mask out the result and transmit it.
-			 */
-			result=priv->bits&0xff;
-			if (self->sendto)
-				ifax_handle_input(self->sendto,&result,1);
-			ifax_dprintf(DEBUG_DEBUG,"HDLC %x, %x\n",priv->bits&0xff,priv->crc);
-		} else	priv->have_stuffed=0;
+		}
 		handled++;
 	}
 	return handled;
 }
 
+int	decode_hdlc_command(ifax_modp self,int cmd,va_list cmds)
+{
+	decode_hdlc_private *priv=(decode_hdlc_private *)self->private;
+	decode_hdlc_deframer *df=priv->deframer;
+	ifax_uint8 *dst;
+	int size, *status;
+
+	switch(cmd)
+	{
+		case CMD_DECODE_HDLC_PACKED:
+			if (!va_arg(cmds,int))
+			{
+				self->handle_input=decode_hdlc_handle;
+				return 0;
+			}
+			if (df==NULL)
+			{
+				if (NULL==(df=malloc(sizeof(decode_hdlc_deframer))))
+					return 1;
+				priv->deframer=df;
+			}
+			df->ones=0;
+			df->hunting=1;
+			df->acc=0;
+			df->accbits=0;
+			df->head=df->tail=0;
+			df->queue[0].length=0;
+			self->handle_input=decode_hdlc_handle_packed;
+			return 0;
+
+		case CMD_DECODE_HDLC_FRAMES:
+			if (df==NULL)
+				return 0;
+			return (df->tail-df->head+_QUEUE_SIZE)%_QUEUE_SIZE;
+
+		case CMD_DECODE_HDLC_GETFRAME:
+			dst=va_arg(cmds,ifax_uint8 *);
+			size=va_arg(cmds,int);
+			status=va_arg(cmds,int *);
+			if (df==NULL)
+				return -1;
+			return fetch_frame(df,dst,size,status);
+	}
+
+	return 0;
+}
+
 int	decode_hdlc_construct(ifax_modp self,va_list args)
 {
 	decode_hdlc_private *priv;
@@ -176,7 +508,13 @@ int	decode_hdlc_construct(ifax_modp self,va_list args)
 
 	priv->syncbitcnt=0;
 	priv->bits=0;
-	priv->have_stuffed=0;
+	priv->line=0;
+	priv->crc=IFAX_CRC16_INIT;
+	priv->framelen=0;
+	priv->deframer=NULL;
+
+	if (!deframe_table_ready)
+		build_deframe_table();
 
 	return 0;
 }
@@ -44,6 +44,8 @@
 #include <ifax/ifax.h>
 #include <ifax/alaw.h>
 #include <ifax/constants.h>
+#include <ifax/misc/malloc.h>
+#include <ifax/modules/bank.h>
 
 /* Turn on to generate a big bunch of debugging code.
  */
@@ -291,3 +293,175 @@ int	fskdemod_construct(ifax_modp self,va_list args)
 
 	return 0;
 }
+
+
+/* The bank version demodulates several channels at once.  The sine
+ * tables and the window positions are the same for all channels and
+ * are shared; only the DFT sums and the window history is kept for
+ * each channel, side by side.  The input is frames of one sample for
+ * each channel, the output frames of a decision/confidence pair for
+ * each channel (like the normal version gives for one channel).
+ *
+ * Parameters are:
+ *      int       number of channels
+ *      ...       followed by the parameters of the normal version
+ */
+
+/* Samples per channel processed in one go */
+#define BANKBLOCK 64
+
+typedef struct {
+
+	ifax_bank	bank;
+	fskdemod_private common;	/* Tables and window positions */
+	int		*currreal[2],	/* [channels] for both frequencies */
+			*currimag[2];
+	char		*histreal[2],	/* [depth][channels] */
+			*histimag[2];
+	unsigned char	*alaw;		/* Current samples, [channels] */
+	unsigned char	*output;	/* [BANKBLOCK][channels][2] */
+
+} fskdemod_bank_private;
+
+/* Slide the DFT windows of all channels by one sample.
+ */
+static void bank_add_samp(fskdemod_bank_private *bp,four_help *hlp,int f)
+{
+	int channels=bp->bank.channels;
+	char *hr,*hi,*st,*ct;
+	int *cr,*ci,c;
+
+	hr=&bp->histreal[f][hlp->currpos*channels];
+	hi=&bp->histimag[f][hlp->currpos*channels];
+	st=&hlp->fasttable[hlp->stpos];
+	ct=&hlp->fasttable[hlp->ctpos];
+	cr=bp->currreal[f];
+	ci=bp->currimag[f];
+
+	for(c=0;c<channels;c++) {
+		cr[c]-=hr[c];
+		ci[c]-=hi[c];
+		cr[c]+=(hr[c]=st[bp->alaw[c]]);
+		ci[c]+=(hi[c]=ct[bp->alaw[c]]);
+	}
+
+	hlp->currpos++ ;if (hlp->currpos>=hlp->depth  ) hlp->currpos=0;
+	hlp->stpos+=256;if (hlp->stpos  >=hlp->stdepth) hlp->stpos=0;
+	hlp->ctpos+=256;if (hlp->ctpos  >=hlp->stdepth) hlp->ctpos=0;
+}
+
+static int fskdemod_bank_handle(ifax_modp self, void *data, size_t length)
+{
+	fskdemod_bank_private *bp=self->private;
+	fskdemod_private *priv=&bp->common;
+	int channels=bp->bank.channels;
+	ifax_sint16 *input=data;
+	unsigned char *dat;
+	int a1,a2,conf,pwr,c;
+	size_t t,chunk,remaining=length;
+
+	while(remaining>0) {
+		chunk=remaining<BANKBLOCK ? remaining : BANKBLOCK;
+		dat=bp->output;
+
+		for(t=0;t<chunk;t++) {
+			for(c=0;c<channels;c++)
+				bp->alaw[c]=sint2wala[((unsigned)*input++>>4)&0xFFF];
+
+			bank_add_samp(bp,&priv->freq1,0);
+			bank_add_samp(bp,&priv->freq2,1);
+
+			for(c=0;c<channels;c++) {
+				a1=bp->currreal[0][c]*bp->currreal[0][c]+
+				   bp->currimag[0][c]*bp->currimag[0][c];
+				a2=bp->currreal[1][c]*bp->currreal[1][c]+
+				   bp->currimag[1][c]*bp->currimag[1][c];
+				if (!a2) a2=1;
+				if (!a1) a1=1;
+				if (a1>a2) { conf=100-100*a2/a1; pwr=a1/priv->freq1.depthsquare; }
+				else       { conf=100-100*a1/a2; pwr=a2/priv->freq2.depthsquare; }
+				*dat++= a1 > a2 ? 1 : 0;
+				*dat++= pwr<10 ? 0 : conf;
+			}
+		}
+
+		bank_output(self,&bp->bank,bp->output,chunk,2);
+		remaining-=chunk;
+	}
+	return length;
+}
+
+static int fskdemod_bank_command(ifax_modp self,int cmd,va_list cmds)
+{
+	fskdemod_bank_private *bp=self->private;
+
+	return bank_command(&bp->bank,cmd,cmds);
+}
+
+static void fskdemod_bank_destroy(ifax_modp self)
+{
+	fskdemod_bank_private *bp=self->private;
+	int f;
+
+	for(f=0;f<2;f++) {
+		free(bp->currreal[f]);
+		free(bp->currimag[f]);
+		free(bp->histreal[f]);
+		free(bp->histimag[f]);
+	}
+	destroy_four_help(&bp->common.freq1);
+	destroy_four_help(&bp->common.freq2);
+	bank_destroy(&bp->bank);
+	free(bp->alaw);
+	free(bp->output);
+	free(self->private);
+}
+
+int	fskdemod_bank_construct(ifax_modp self,va_list args)
+{
+	fskdemod_bank_private *bp;
+	fskdemod_private *priv;
+	int channels,sampbaud,f;
+
+	bp=self->private=ifax_malloc(sizeof(fskdemod_bank_private),
+				     "FSK demodulator bank instance");
+	self->destroy		=fskdemod_bank_destroy;
+	self->handle_input	=fskdemod_bank_handle;
+	self->command		=fskdemod_bank_command;
+
+	channels=va_arg(args,int);
+	if (channels<1) {
+		free(bp);
+		return 1;
+	}
+	bank_initialize(&bp->bank,channels);
+
+	priv=&bp->common;
+	priv->sps =va_arg(args,int);
+	priv->f1  =va_arg(args,int);
+	priv->f2  =va_arg(args,int);
+	priv->baud=va_arg(args,int);
+
+	sampbaud=(priv->sps+priv->baud)/priv->baud;
+
+	/* The tables are set up as for a single channel, the small
+	 * history of the shared window is just not used.
+	 */
+	init_four_help(priv,&priv->freq1,sampbaud,priv->f1);
+	init_four_help(priv,&priv->freq2,sampbaud,priv->f2);
+
+	for(f=0;f<2;f++) {
+		bp->currreal[f]=ifax_malloc(sizeof(int)*channels,
+					    "FSK bank sums");
+		bp->currimag[f]=ifax_malloc(sizeof(int)*channels,
+					    "FSK bank sums");
+		bp->histreal[f]=ifax_malloc(sampbaud*channels,
+					    "FSK bank history");
+		bp->histimag[f]=ifax_malloc(sampbaud*channels,
+					    "FSK bank history");
+	}
+	bp->alaw=ifax_malloc(channels,"FSK bank samples");
+	bp->output=ifax_malloc(BANKBLOCK*channels*2,"FSK bank output");
+
+	return 0;
+}
@@ -39,14 +39,20 @@
  *
  *    Commands supported:
  *       CMD_LINEDRIVER_WORK
- *       CMD_LINEDRIVER_AUDIO
- *       CMD_LINEDRIVER_ISDN,<ih>
+ *       CMD_LINEDRIVER_AUDIO,<monitor>
+ *       CMD_LINEDRIVER_HARDWARE,<hh>
  *       CMD_LINEDRIVER_LOOPBACK
  *       CMD_LINEDRIVER_RECORD,<filename>
+ *       CMD_LINEDRIVER_STATS,<linedriver_stats *>
  *
  *    Parameters:
  *       None
  *
+ * Monitoring is done by a separate module (see monitor.c) that is
+ * given the transmitted and received samples interleaved; a NULL
+ * monitor stops it.  Recording to a WAV file is done the same way, but
+ * without the module.
+ *
  * NOTE: This module will produce a constant stream of (real-time)
  * samples when online.  When online, the signal chain feeding this
  * linedriver module must be prepared to deliver samples at any time
@@ -60,32 +66,44 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <unistd.h>
+#include <string.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
-#include <sys/ioctl.h>
-#include <linux/soundcard.h>
 
 #include <ifax/ifax.h>
 #include <ifax/types.h>
 #include <ifax/misc/malloc.h>
-#include <ifax/misc/isdnline.h>
+#include <ifax/misc/hardware-driver.h>
+#include <ifax/misc/recorder.h>
 #include <ifax/modules/linedriver.h>
 
 /*
  * These defines should probably be run-time configurable.
- * BUFFERSIZE is the size of the main output buffer which is
- * filled by the handle function (incomming signal-chain).
- * We need a buffer here since the signaling-chain may not generate
+ * QUEUESIZE is the number of buffers the main output queue can hold.
+ * The queue is filled by the handle function (incomming signal-chain).
+ * We need a queue here since the signaling-chain may not generate
  * the exact number of samples requested.
  *
  * MAXIOSIZE is the maximum number of samples we can transmit/receive
  * before we call the signal chains to fill/drain the buffers.
  */
 
-#define BUFFERSIZE      512
+#define QUEUESIZE       32
 #define MAXIOSIZE       256
 
+/*
+ * The playout lead is the number of samples written to the line ahead
+ * of those read from it, i.e. how long the line can go without being
+ * serviced before it runs out of samples to send.  Its target is set
+ * from the largest number of samples read at once lately (how late
+ * we have been), plus a margin, and kept within these limits.
+ */
+
+#define LEAD_MIN        64
+#define LEAD_MAX        1024
+#define LEAD_MARGIN     (MAXIOSIZE/4)
+
 
 /*
  * An instance of this linedriver module holds the following
@@ -94,22 +112,31 @@
 
 typedef struct {
 
-  int dsp_fd;                     /* File-descriptor for audio-monitoring */
-  int rec_fd;                     /* File-descriptor for recording */
+  ifax_modp monitor;              /* Monitoring module, or NULL */
+  struct Recorder *rec;           /* Recording, or NULL */
   struct HardwareHandle *hh;	  /* Handle for the phone interface */
   int loopback;                   /* Nonzero if software loopback enabled */
-  ifax_sint32 dsp_rx_volume;      /* Audio-monitoring Rx-level */
-  ifax_sint32 dsp_tx_volume;      /* Audio-monitoring Tx-level */
 
   ifax_sint16 tx_buffer[MAXIOSIZE];         /* Transmit buffer */
   ifax_sint16 rx_buffer[MAXIOSIZE];         /* Receive buffer */
   ifax_sint16 stereo_buffer[2*MAXIOSIZE];   /* Monitoring/recording buffer */
 
   struct queue {                  /* Output queue */
-    int wp, rp, size;
-    ifax_sint16 buffer[BUFFERSIZE];
+    int wp, rp, count;            /* Ring of queued buffers */
+    int size;                     /* Samples queued in total */
+    size_t offset;                /* Samples used from oldest buffer */
+    ifax_buffer *buffer[QUEUESIZE];
   } output;
 
+  struct playout {                /* Playout lead, see above */
+    int online;                   /* Line was online last round */
+    int peak;                     /* Largest read lately, times 16 */
+    int lead;                     /* On the line after the last write */
+    int start, read, written;     /* Lead, samples moved in this call */
+    int late;                     /* Underrun counted in this call */
+    linedriver_stats stats;       /* For the current/last call */
+  } playout;
+
 } linedriver_private;
 
 
@@ -122,33 +149,229 @@ typedef struct {
  * CMD_LINEDRIVER_WORK command can act depending on the (new) size of
  * the output-queue.
  *
+ * The output queue holds references to the buffers delivered by the
+ * signal chain, and the samples are written to the hardware straight
+ * out of these buffers.
+ *
  * The input-queue is filled and the signal-chain is called.  When the
  * signal chain returns, the number of samples involved is returned,
  * so the timers may be updated.
  */
 
-static int linedriver_handle(ifax_modp self, void *data, size_t length)
+static int linedriver_handle_buffer(ifax_modp self, ifax_buffer *buf)
 {
   linedriver_private *priv = self->private;
+  size_t length = buf->length;
+
+  if ( priv->output.count >= QUEUESIZE || length == 0 ) {
+    if ( length ) {
+      ifax_dprintf(DEBUG_ERROR,"Linedriver queue full, %d samples lost\n",
+		   (int)length);
+      priv->playout.stats.overruns += length;
+    }
+    ifax_buffer_unref(buf);
+    return 0;
+  }
+
+  priv->output.buffer[priv->output.wp++] = buf;
+  if ( priv->output.wp >= QUEUESIZE )
+    priv->output.wp = 0;
+  priv->output.count++;
+  priv->output.size += length;
+
+  return length;
+}
+
+static int linedriver_handle(ifax_modp self, void *data, size_t length)
+{
   ifax_sint16 *src = data;
-  size_t remaining = length;
-   
+  size_t chunk, remaining = length;
+  ifax_buffer *buf;
+
+  /* Modules not using buffers are copied into pooled buffers here */
+
   while ( remaining > 0 ) {
-    priv->output.buffer[priv->output.wp++] = *src++;
-    priv->output.size++;
-    if (priv->output.wp >= BUFFERSIZE)
-      priv->output.wp = 0;
-    remaining--;
+    chunk = remaining;
+    if ( chunk > IFAX_BUFFER_SAMPLES )
+      chunk = IFAX_BUFFER_SAMPLES;
+    if ( (buf = ifax_buffer_alloc(IFAX_FORMAT_S16,chunk)) == 0 )
+      break;
+    memcpy(buf->data,src,chunk*sizeof(ifax_sint16));
+    linedriver_handle_buffer(self,buf);
+    src += chunk;
+    remaining -= chunk;
   }
    
   return length;
 }
 
+/* Take 'chunk' samples from the output queue and transmit them.  If
+ * the samples are needed for monitoring etc., they are copied to the
+ * tx_buffer as well, except the first 'skip' ones.  Should the queue
+ * run dry, silence is sent.
+ */
+
+static void transmit(linedriver_private *priv, int chunk, int skip,
+		     int online)
+{
+  static ifax_sint16 silence[MAXIOSIZE];
+  struct HardwareHandle *hh = priv->hh;
+  ifax_buffer *buf;
+  ifax_sint16 *src;
+  int t, n, keep_tx;
+
+  keep_tx = priv->loopback || priv->monitor != 0 || priv->rec != 0;
+
+  for ( t=0; t < chunk; t += n ) {
+
+    if ( priv->output.count == 0 ) {
+      buf = 0;
+      src = silence;
+      n = chunk - t;
+      if ( n > MAXIOSIZE )
+	n = MAXIOSIZE;
+    } else {
+      buf = priv->output.buffer[priv->output.rp];
+      src = (ifax_sint16 *)buf->data + priv->output.offset;
+      n = buf->length - priv->output.offset;
+      if ( n > chunk - t )
+	n = chunk - t;
+    }
+
+    if ( t < skip && n > skip - t )
+      n = skip - t;		/* Don't mix skipped and kept samples */
+
+    if ( buf == 0 ) {
+      if ( online ) {
+	hh->write(hh,silence,n);
+	priv->playout.stats.silence += n;
+      }
+      if ( keep_tx && t >= skip )
+	memset(&priv->tx_buffer[t-skip],0,n*sizeof(ifax_sint16));
+      continue;
+    }
+
+    if ( online && buf->refcount > 1 ) {
+      /* The hardware driver writes back the quantized samples */
+      if ( (buf = ifax_buffer_writable(buf)) == 0 )
+	return;
+      priv->output.buffer[priv->output.rp] = buf;
+      src = (ifax_sint16 *)buf->data + priv->output.offset;
+    }
+
+    if ( online )
+      hh->write(hh,src,n);
+    if ( keep_tx && t >= skip )
+      memcpy(&priv->tx_buffer[t-skip],src,n*sizeof(ifax_sint16));
+
+    priv->output.offset += n;
+    priv->output.size -= n;
+
+    if ( priv->output.offset >= buf->length ) {
+      ifax_buffer_unref(buf);
+      priv->output.offset = 0;
+      priv->output.count--;
+      if ( ++priv->output.rp >= QUEUESIZE )
+	priv->output.rp = 0;
+    }
+  }
+}
+
+/* Both directions of an ISDN line run on the clock of the network, so
+ * the samples read in a call to 'work' tell how many have been sent
+ * since the last call.  If that is more than the lead left then, the
+ * line ran out (underrun); what is written in this call comes too late
+ * to help.
+ */
+
+static void playout_begin(linedriver_private *priv)
+{
+  struct playout *po = &priv->playout;
+
+  po->start = po->lead;
+  po->read = po->written = 0;
+  po->late = 0;
+}
+
+/* Called for every round with the line online, after 'chunk' samples
+ * have been read.  Returns how many more (or fewer) samples than
+ * 'chunk' to write to move the lead towards its target.
+ */
+
+static int playout_adjust(linedriver_private *priv, int chunk)
+{
+  struct playout *po = &priv->playout;
+  int target, diff, left;
+
+  if ( !po->online ) {
+    /* A new call */
+    memset(&po->stats,0,sizeof(po->stats));
+    po->peak = 0;
+    po->start = po->lead = 0;
+    po->late = 1;
+    po->online = 1;
+  }
+
+  po->read += chunk;
+  if ( po->read > po->start && !po->late ) {
+    po->stats.underruns++;
+    po->late = 1;
+  }
+
+  left = po->start - po->read;
+  if ( left < 0 )
+    left = 0;
+  po->stats.lead = left + po->written;
+
+  /* How late we are, from the samples read since the last call */
+  if ( po->read * 16 > po->peak )
+    po->peak = po->read * 16;
+  else
+    po->peak -= po->peak >> 8;
+
+  target = po->peak / 16 + LEAD_MARGIN;
+  if ( target < LEAD_MIN )
+    target = LEAD_MIN;
+  if ( target > LEAD_MAX )
+    target = LEAD_MAX;
+  po->stats.target = target;
+
+  diff = target - po->stats.lead;
+
+  if ( diff > 0 )
+    return diff > MAXIOSIZE ? MAXIOSIZE : diff;
+
+  /* Shorten the lead slowly, and only when well above the target */
+  diff = -diff - LEAD_MARGIN;
+  if ( diff > 0 )
+    return diff > chunk/4 ? -(chunk/4) : -diff;
+
+  return 0;
+}
+
+static void playout_written(linedriver_private *priv, int send)
+{
+  struct playout *po = &priv->playout;
+  int left;
+
+  po->written += send;
+  left = po->start - po->read;
+  po->lead = (left > 0 ? left : 0) + po->written;
+}
+
+static void playout_finish(linedriver_private *priv)
+{
+  linedriver_stats *st = &priv->playout.stats;
+
+  priv->playout.online = 0;
+  ifax_dprintf(DEBUG_INFO,"Linedriver: %d underruns, %d samples of silence, "
+	       "%d samples lost, playout lead %d of %d\n",st->underruns,
+	       st->silence,st->overruns,st->lead,st->target);
+}
+
 static int work(ifax_modp self)
 {
-	int wanted, chunk, total, more, t;
-	ifax_sint32 sp;
-	ifax_uint32 up;
+	int wanted, chunk, total, more, online, t, adjust, send, queued;
 	linedriver_private *priv = self->private;
 	struct HardwareHandle *hh;
 
@@ -161,42 +384,57 @@ static int work(ifax_modp self)
 	 */
 
 	total = more = 0;
+	playout_begin(priv);
 
 	do {
 
 		chunk = MAXIOSIZE;	/* Default size of IO-operations */
+		online = priv->hh != 0 && priv->hh->state == ONLINE;
+		adjust = 0;
 
-		if ( priv->hh != 0 && priv->hh->state == ONLINE ) {
+		if ( online ) {
 			/* Hardware is online, read first, then transmit */
 			hh = priv->hh;
 			chunk = hh->read(hh,&priv->rx_buffer[0],MAXIOSIZE);
 			if ( chunk < 0 )
 				return -1;
 			more = chunk == MAXIOSIZE;
+			adjust = playout_adjust(priv,chunk);
 		} else {
+			if ( priv->playout.online )
+				playout_finish(priv);
 			for ( t=0; t < chunk; t++)
 				priv->rx_buffer[t] = 0;
 		}
 		
-
-		/* Fill output queue by demanding data (if needed) */
-		while ( priv->output.size < chunk ) {
-			wanted = chunk - priv->output.size + 5;
+		/* The extra samples for a longer lead go out first, and
+		 * a shorter lead shows as silence when monitoring.
+		 */
+		send = chunk + adjust;
+
+		/* Fill output queue by demanding data (if needed).  With
+		 * no source, or one that has nothing, silence is sent.
+		 */
+		while ( self->recvfrom != 0
+			&& priv->output.size < send
+			&& priv->output.count < QUEUESIZE ) {
+			queued = priv->output.size;
+			wanted = send - priv->output.size + 5;
 			ifax_handle_demand (self->recvfrom, wanted);
+			if ( priv->output.size == queued )
+				break;
 		}
 
-		/* Prepare TX-buffer */
-		priv->output.size -= chunk;
-		for (t = 0; t < chunk; t++) {
-			priv->tx_buffer[t] = priv->output.buffer[priv->output.rp++];
-			if ( priv->output.rp >= BUFFERSIZE )
-				priv->output.rp = 0;
-		}
-
-		if ( priv->ih != 0 ) {
-			/* ISDN is online, send TX-buffer */
-			IsdnWriteSamples(priv->ih,&priv->tx_buffer[0],chunk);
+		/* Send the TX-samples on their way */
+		if ( adjust >= 0 ) {
+			transmit(priv,send,adjust,online);
+		} else {
+			transmit(priv,send,0,online);
+			memset(&priv->tx_buffer[send],0,
+			       -adjust*sizeof(ifax_sint16));
 		}
+		if ( online )
+			playout_written(priv,send);
 
 		if ( priv->loopback ) {
 			/* Software loopback enabled, overwrite receive-buffer */
@@ -204,31 +442,19 @@ static int work(ifax_modp self)
 				priv->rx_buffer[t] = priv->tx_buffer[t];
 		}
 
-		if ( priv->dsp_fd >= 0 ) {
-			/* Soundcard audio monitoring enabled */
-			for ( t=0; t < chunk; t++ ) {
-				sp = priv->tx_buffer[t] * priv->dsp_tx_volume;
-				up = sp;
-				up >>= 16;
-				priv->stereo_buffer[t+t+0] = up;
-
-				sp = priv->rx_buffer[t] * priv->dsp_rx_volume;
-				up = sp;
-				up >>= 16;
-				priv->stereo_buffer[t+t+1] = up;
-			}
-
-			write(priv->dsp_fd, priv->stereo_buffer, 4*chunk);
-		}
-
-		if ( priv->rec_fd >= 0 ) {
-			/* Recording all audio to file */
+		if ( priv->monitor != 0 || priv->rec != 0 ) {
+			/* Monitoring/recording, neither of them blocks */
 			for ( t=0; t < chunk; t++ ) {
 				priv->stereo_buffer[t+t+0] = priv->tx_buffer[t];
 				priv->stereo_buffer[t+t+1] = priv->rx_buffer[t];
 			}
 
-			write(priv->rec_fd, priv->stereo_buffer, 4*chunk);
+			if ( priv->monitor != 0 )
+				ifax_handle_input(priv->monitor,
+						  priv->stereo_buffer, chunk);
+			if ( priv->rec != 0 )
+				recorder_write(priv->rec,
+					       priv->stereo_buffer, chunk);
 		}
 
 		if ( self->sendto != 0 ) {
@@ -243,44 +469,36 @@ static int work(ifax_modp self)
 	return total;
 }
 
-static void linedriver_destroy(ifax_modp self)
-{
-  free(self->private);
-}
+/* The recording is a stereo WAV file, transmitted samples to the left
+ * and received ones to the right.
+ */
 
-static int init_audio(void)
+static void start_recording(linedriver_private *priv, char *file)
 {
-  int rate = 8000;
-  int stereo = 1;
-  int format = AFMT_S16_LE;
-  int smplsize = 16;
-  int dspfd, bufsize, err = 0;
-
-  dspfd = open ("/dev/dsp", O_WRONLY);
-
-  err |= ioctl (dspfd, SNDCTL_DSP_GETBLKSIZE, &bufsize);
-  err |= ioctl (dspfd, SNDCTL_DSP_SPEED, &rate);
-  err |= ioctl (dspfd, SNDCTL_DSP_STEREO, &stereo);
-  err |= ioctl (dspfd, SNDCTL_DSP_SAMPLESIZE, &smplsize);
-  err |= ioctl (dspfd, SNDCTL_DSP_SETFMT, &format);
-
-  if ( dspfd < 0 || err || bufsize < MAXIOSIZE ) {
-    if ( dspfd >= 0 )
-      close(dspfd);
-    dspfd = -1;
-  }
-
-  return dspfd;
+  if ( priv->rec != 0 )
+    recorder_stop(priv->rec);
+  priv->rec = recorder_start(file,2,8000);
 }
 
-static int start_recording(char *file)
+static void stop_recording(linedriver_private *priv)
 {
-  return creat(file,0660);
+  if ( priv->rec != 0 )
+    recorder_stop(priv->rec);
+  priv->rec = 0;
 }
 
-static void stop_recording(int fd)
+static void linedriver_destroy(ifax_modp self)
 {
-  close(fd);
+  linedriver_private *priv = self->private;
+
+  while ( priv->output.count-- > 0 ) {
+    ifax_buffer_unref(priv->output.buffer[priv->output.rp++]);
+    if ( priv->output.rp >= QUEUESIZE )
+      priv->output.rp = 0;
+  }
+
+  stop_recording(priv);
+  free(self->private);
 }
 
 static int linedriver_command(ifax_modp self, int cmd, va_list cmds)
@@ -295,7 +513,7 @@ static int linedriver_command(ifax_modp self, int cmd, va_list cmds)
       break;
 
     case CMD_LINEDRIVER_AUDIO:
-      priv->dsp_fd = init_audio();
+      priv->monitor = va_arg(cmds,ifax_modp);
       break;
 
     case CMD_LINEDRIVER_HARDWARE:
@@ -308,12 +526,14 @@ static int linedriver_command(ifax_modp self, int cmd, va_list cmds)
 
     case CMD_LINEDRIVER_RECORD:
       filename = va_arg(cmds,char *);
-      if ( filename != 0 ) {
-	priv->rec_fd = start_recording(filename);
-      } else {
-	stop_recording(priv->rec_fd);
-	priv->rec_fd = -1;
-      }
+      if ( filename != 0 )
+	start_recording(priv,filename);
+      else
+	stop_recording(priv);
+      break;
+
+    case CMD_LINEDRIVER_STATS:
+      *va_arg(cmds,linedriver_stats *) = priv->playout.stats;
       break;
 
     default:
@@ -332,18 +552,22 @@ int linedriver_construct (ifax_modp self, va_list args)
 
   self->destroy = linedriver_destroy;
   self->handle_input = linedriver_handle;
+  self->handle_buffer = linedriver_handle_buffer;
+  self->input_format = IFAX_FORMAT_S16;
+  self->output_format = IFAX_FORMAT_S16;
   self->command = linedriver_command;
 
   priv->output.wp = 0;
   priv->output.rp = 0;
+  priv->output.count = 0;
   priv->output.size = 0;
+  priv->output.offset = 0;
+  priv->playout.online = 0;
 
-  priv->ih = 0;
+  priv->hh = 0;
   priv->loopback = 0;
-  priv->dsp_fd = -1;
-  priv->rec_fd = -1;
-  priv->dsp_rx_volume = 0x8000;
-  priv->dsp_tx_volume = 0x6000;
+  priv->monitor = 0;
+  priv->rec = 0;
 
   return 0;
 }
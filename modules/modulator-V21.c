@@ -57,6 +57,7 @@
 #include <ifax/ifax.h>
 #include <ifax/misc/malloc.h>
 #include <ifax/modules/modulator-V21.h>
+#include <ifax/modules/bank.h>
 
 /* The following two defines are closely related, and must not be changed */
 #define SAMPLERATE 7200
@@ -65,10 +66,12 @@
 
 #define MAXBUFFER 256
 
+/* Bits modulated into each buffer, must be a multiple of 8 */
+#define CHUNKBITS ((MAXBUFFER/SAMPLESPERBIT) & ~7)
+
 
 typedef struct {
 
-  ifax_sint16 buffer[MAXBUFFER];
   ifax_uint16 w;
   ifax_uint8 prevbit;
   int channel;
@@ -120,66 +123,86 @@ static unsigned short phaseinc[2][SAMPLESPERBIT] = {
 };
 
 
-static int modulator_V21_handle(ifax_modp self, void *data, size_t length)
+/* Modulate 'length' bits from 'src' into 'dst', SAMPLESPERBIT samples
+ * for each bit.
+ */
+
+static size_t modulate(modulator_V21_private *priv, ifax_uint8 *src,
+		       size_t length, ifax_sint16 *dst)
 {
-  modulator_V21_private *priv = self->private;
-  size_t remaining = length;
-  ifax_uint8 v, *src = data;
-  int fillbuffer, idx, delta, n, t;
-  ifax_sint32 sp;
-  ifax_uint32 up;
+  ifax_uint8 v = 0;
+  int idx, delta;
+  size_t n;
 
-  fillbuffer = 0;
+  for ( n=0; n < length; n++ ) {
 
-  while ( remaining > 0 ) {
-    v = *src++;
-    for ( n=0; n < 8; n++ ) {
-
-      if ( v & 1 ) {
-	/* Logical '1' */
-	if ( priv->prevbit & 1 ) {
-	  idx = 0;
-	  delta = 0;
-	} else {
-	  idx = SAMPLESPERBIT-1;
-	  delta = -1;
-	}
+    if ( (n & 7) == 0 )
+      v = *src++;
+
+    if ( v & 1 ) {
+      /* Logical '1' */
+      if ( priv->prevbit & 1 ) {
+	idx = 0;
+	delta = 0;
       } else {
-	/* Logical '0' */
-	if ( priv->prevbit & 1 ) {
-	  idx = 0;
-	  delta = 1;
-	} else {
-	  idx = SAMPLESPERBIT-1;
-	  delta = 0;
-	}
+	idx = SAMPLESPERBIT-1;
+	delta = -1;
       }
-
-      priv->prevbit = v;
-      v >>= 1;
-
-      for ( t=0; t < SAMPLESPERBIT; t++ ) {
-	sp = intsin(priv->w) * 0x0A000;
-	up = sp;
-	up >>= 16;
-	priv->buffer[fillbuffer++] = up;
-	priv->w += phaseinc[priv->channel][idx];
-	idx += delta;
+    } else {
+      /* Logical '0' */
+      if ( priv->prevbit & 1 ) {
+	idx = 0;
+	delta = 1;
+      } else {
+	idx = SAMPLESPERBIT-1;
+	delta = 0;
       }
+    }
 
-      if ( fillbuffer >= (MAXBUFFER-SAMPLESPERBIT-2) ) {
-	ifax_handle_input(self->sendto,priv->buffer,fillbuffer);
-	fillbuffer = 0;
-      }
+    priv->prevbit = v;
+    v >>= 1;
 
-      remaining--;
-      if ( ! remaining )
-	break;
-    }
+    priv->w = intsin_sweep(dst,1,SAMPLESPERBIT,priv->w,
+			   &phaseinc[priv->channel][idx],delta,0x0A000);
+    dst += SAMPLESPERBIT;
   }
 
-  if ( fillbuffer )
-    ifax_handle_input(self->sendto,priv->buffer,fillbuffer);
+  return length * SAMPLESPERBIT;
+}
+
+static size_t modulator_V21_process(ifax_modp self, void *in, size_t length,
+				    void *out)
+{
+  return modulate(self->private,in,length,out);
+}
+
+static size_t modulator_V21_max(ifax_modp self, size_t length)
+{
+  return length * SAMPLESPERBIT;
+}
+
+static int modulator_V21_handle(ifax_modp self, void *data, size_t length)
+{
+  modulator_V21_private *priv = self->private;
+  size_t chunk, remaining = length;
+  ifax_uint8 *src = data;
+  ifax_buffer *buf;
+
+  /* Modulate straight into pooled buffers, a whole number of bytes
+   * worth of bits at a time.
+   */
+
+  while ( remaining > 0 ) {
+    chunk = remaining;
+    if ( chunk > CHUNKBITS )
+      chunk = CHUNKBITS;
+    if ( (buf = ifax_buffer_alloc(IFAX_FORMAT_S16,MAXBUFFER)) == 0 )
+      return length - remaining;
+    buf->length = modulate(priv,src,chunk,buf->data);
+    ifax_handle_buffer(self->sendto,buf);
+    src += chunk/8;
+    remaining -= chunk;
+  }
 
   return length;
 }
@@ -217,6 +240,10 @@ int modulator_V21_construct(ifax_modp self,va_list args)
   self->handle_input = modulator_V21_handle;
   self->handle_demand = modulator_V21_demand;
   self->command = modulator_V21_command;
+  self->process = modulator_V21_process;
+  self->process_max = modulator_V21_max;
+  self->input_format = IFAX_FORMAT_BITS;
+  self->output_format = IFAX_FORMAT_S16;
 
   priv->w = 0;
   priv->channel = (va_arg(args,int)) - 1;
@@ -224,3 +251,140 @@ int modulator_V21_construct(ifax_modp self,va_list args)
 
   return 0;
 }
+
+
+/* The bank version modulates several channels at once.  The input is
+ * frames of one byte for each channel, each byte holding 8 bits for its
+ * channel (first bit in LSB), and the length is the number of bits per
+ * channel.  The output is frames of one sample for each channel.
+ *
+ * Parameters are:
+ *      int       number of channels
+ *      int       V.21 channel number to modulate (1 or 2)
+ */
+
+/* Bits modulated per channel in one go */
+#define BANKBITS 8
+
+typedef struct {
+
+  ifax_bank bank;
+  int channel;
+  ifax_uint16 *w;		/* [channels] */
+  ifax_uint8 *prevbit;		/* [channels] */
+  int *idx, *delta;		/* [channels] */
+  ifax_sint16 *output;		/* [BANKBITS*SAMPLESPERBIT][channels] */
+
+} modulator_V21_bank_private;
+
+
+static void bank_modulate(modulator_V21_bank_private *bp, ifax_uint8 *src,
+			  size_t bits, ifax_sint16 *dst)
+{
+  int channels = bp->bank.channels;
+  unsigned short *inc = phaseinc[bp->channel];
+  ifax_uint8 v;
+  size_t n;
+  int c;
+
+  for ( n=0; n < bits; n++ ) {
+
+    /* Find the frequency transition of each channel for this bit */
+
+    for ( c=0; c < channels; c++ ) {
+      v = (src[c] >> (n & 7)) & 1;
+      if ( v == (bp->prevbit[c] & 1) ) {
+	bp->idx[c] = v ? 0 : SAMPLESPERBIT-1;
+	bp->delta[c] = 0;
+      } else {
+	bp->idx[c] = v ? SAMPLESPERBIT-1 : 0;
+	bp->delta[c] = v ? -1 : 1;
+      }
+      bp->prevbit[c] = v;
+    }
+
+    if ( (n & 7) == 7 )
+      src += channels;
+
+    for ( c=0; c < channels; c++ )
+      bp->w[c] = intsin_sweep(dst+c,channels,SAMPLESPERBIT,bp->w[c],
+			      &inc[bp->idx[c]],bp->delta[c],0x0A000);
+    dst += channels * SAMPLESPERBIT;
+  }
+}
+
+static int modulator_V21_bank_handle(ifax_modp self, void *data,
+				     size_t length)
+{
+  modulator_V21_bank_private *bp = self->private;
+  size_t chunk, remaining = length;
+  ifax_uint8 *src = data;
+
+  while ( remaining > 0 ) {
+    chunk = remaining;
+    if ( chunk > BANKBITS )
+      chunk = BANKBITS;
+    bank_modulate(bp,src,chunk,bp->output);
+    bank_output(self,&bp->bank,bp->output,chunk*SAMPLESPERBIT,
+		sizeof(ifax_sint16));
+    src += bp->bank.channels * (BANKBITS/8);
+    remaining -= chunk;
+  }
+
+  return length;
+}
+
+static int modulator_V21_bank_command(ifax_modp self, int cmd, va_list cmds)
+{
+  modulator_V21_bank_private *bp = self->private;
+
+  return bank_command(&bp->bank,cmd,cmds);
+}
+
+static void modulator_V21_bank_destroy(ifax_modp self)
+{
+  modulator_V21_bank_private *bp = self->private;
+
+  bank_destroy(&bp->bank);
+  free(bp->w);
+  free(bp->prevbit);
+  free(bp->idx);
+  free(bp->delta);
+  free(bp->output);
+  free(self->private);
+}
+
+int modulator_V21_bank_construct(ifax_modp self,va_list args)
+{
+  modulator_V21_bank_private *bp;
+  int c, channels;
+
+  bp = ifax_malloc(sizeof(modulator_V21_bank_private),
+		   "V.21 modulator bank instance");
+  self->private = bp;
+
+  self->destroy = modulator_V21_bank_destroy;
+  self->handle_input = modulator_V21_bank_handle;
+  self->handle_demand = modulator_V21_demand;
+  self->command = modulator_V21_bank_command;
+
+  channels = va_arg(args,int);
+  if ( channels < 1 ) {
+    free(bp);
+    return 1;
+  }
+  bank_initialize(&bp->bank,channels);
+  bp->channel = (va_arg(args,int)) - 1;
+
+  bp->w = ifax_malloc(sizeof(*bp->w)*channels,"V.21 bank phases");
+  bp->prevbit = ifax_malloc(sizeof(*bp->prevbit)*channels,"V.21 bank bits");
+  bp->idx = ifax_malloc(sizeof(*bp->idx)*channels,"V.21 bank index");
+  bp->delta = ifax_malloc(sizeof(*bp->delta)*channels,"V.21 bank delta");
+  bp->output = ifax_malloc(sizeof(*bp->output)*channels*
+			   BANKBITS*SAMPLESPERBIT,"V.21 bank output");
+
+  for ( c=0; c < channels; c++ )
+    bp->prevbit[c] = 1;
+
+  return 0;
+}
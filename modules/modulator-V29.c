@@ -104,7 +104,9 @@
       ifax_uint8 phase, randseq;
       int syncseq;
       ifax_sint16 ReIm[FILTSIZELP2400*4];
-      ifax_sint16 buffer[BUFFERSIZE+2*SAMPLESPERSYMBOL];
+      ifax_buffer *buffer;
+      ifax_sint16 *direct;
+      size_t direct_size;
    
    } modulator_V29_private;
 
@@ -207,12 +209,17 @@
    ifax_sint16 lowpass2400[FILTSIZELP2400] =
    {0xFB96, 0x01A76, 0x05555, 0x01A76, 0xFB96};
 
-/* Empty the output buffer by sending it on */
+/* Empty the output buffer by sending it on.  The samples are written
+ * straight into a pooled buffer, which is handed over to the next
+ * module as it is.
+ */
 
    static void send_buffer(ifax_modp self, modulator_V29_private *priv)
    {
       if ( priv->buffer_size > 0 ) {
-         ifax_handle_input(self->sendto,priv->buffer,priv->buffer_size);
+         priv->buffer->length = priv->buffer_size;
+         ifax_handle_buffer(self->sendto,priv->buffer);
+         priv->buffer = 0;
       }
       priv->buffer_size = 0;
    }
@@ -237,12 +244,26 @@
    ifax_sint16 Re, ifax_sint16 Im)
    {
       ifax_sint16 *dp, *cp, *term, *dst, tmp;
+      ifax_sint16 carrier_cos[SAMPLESPERSYMBOL], carrier_sin[SAMPLESPERSYMBOL];
       ifax_sint32 Re_sum, Im_sum, sum;
       int s;
    
-      static int cnt = 0;
+      if ( priv->direct != 0 ) {
+      /* Called from a pipeline, which has its own output buffer */
+         dst = priv->direct + priv->direct_size;
+      }
+      else {
+         if ( priv->buffer == 0 ) {
+            priv->buffer = ifax_buffer_alloc(IFAX_FORMAT_S16,
+					     BUFFERSIZE+2*SAMPLESPERSYMBOL);
+            if ( priv->buffer == 0 )
+               return;
+         }
+         dst = (ifax_sint16 *)priv->buffer->data + priv->buffer_size;
+      }
    
-      dst = &priv->buffer[priv->buffer_size];
+      priv->w = intsincos_block(carrier_cos,carrier_sin,SAMPLESPERSYMBOL,
+				priv->w,PHASEINC1700HZ);
    
       for ( s=0; s < SAMPLESPERSYMBOL; s++ ) {
       
@@ -274,18 +295,21 @@
       
          tmp = Re_sum >> 15;
          /* switched lpf off, olli*/
-         sum = intcos(priv->w) * Re;
+         sum = carrier_cos[s] * Re;
       
          tmp = Im_sum >> 15;
       	/* switched lpf off, olli*/
-         sum += intsin(priv->w) * Im;
+         sum += carrier_sin[s] * Im;
       
          tmp = sum >> 15;
          *dst++ = tmp;
-      
-         priv->w += PHASEINC1700HZ;
       }
    	
+      if ( priv->direct != 0 ) {
+         priv->direct_size += SAMPLESPERSYMBOL;
+         return;
+      }
+   
       priv->buffer_size += SAMPLESPERSYMBOL;
       if ( priv->buffer_size >= BUFFERSIZE )
          send_buffer(self,priv);
@@ -344,9 +368,13 @@
    }
 
 
-   int modulator_V29_handle(ifax_modp self, void *data, size_t length)
+/* Modulate as many symbols as possible from the bits supplied and
+ * those left in the bitstore.
+ */
+
+   static void modulate_bits(ifax_modp self, modulator_V29_private *priv,
+   void *data, size_t length)
    {
-      modulator_V29_private *priv = self->private;
       size_t remaining = length;
       ifax_uint8 *dp = data;
       ifax_uint16 new_bits;
@@ -386,12 +414,43 @@
          if ( priv->bitstore_size >= priv->bits_per_symbol )
             modulate_encoded_symbol(self,priv);
       }
+   }
+
+   int modulator_V29_handle(ifax_modp self, void *data, size_t length)
+   {
+      modulator_V29_private *priv = self->private;
    
+      modulate_bits(self,priv,data,length);
       send_buffer(self,priv);
    
       return length;
    }
 
+/* The 'process' method used by pipelines modulates straight into
+ * the output supplied.  Samples still in our own buffer are sent on
+ * first, so they don't arrive after the new ones.
+ */
+
+   static size_t modulator_V29_process(ifax_modp self, void *in,
+   size_t length, void *out)
+   {
+      modulator_V29_private *priv = self->private;
+   
+      send_buffer(self,priv);
+   
+      priv->direct = out;
+      priv->direct_size = 0;
+      modulate_bits(self,priv,in,length);
+      priv->direct = 0;
+   
+      return priv->direct_size;
+   }
+
+   static size_t modulator_V29_max(ifax_modp self, size_t length)
+   {
+      return ((length+3)/2 + 1) * SAMPLESPERSYMBOL;
+   }
+
    static void modulator_V29_demand(ifax_modp self, size_t demand)
    {
       modulator_V29_private *priv = self->private;
@@ -506,6 +565,10 @@
 
    static void modulator_V29_destroy(ifax_modp self)
    {
+      modulator_V29_private *priv = self->private;
+   
+      if ( priv->buffer != 0 )
+         ifax_buffer_unref(priv->buffer);
       free(self->private);
    }
 
@@ -540,6 +603,10 @@
       self->handle_input = modulator_V29_handle;
       self->handle_demand = modulator_V29_demand;
       self->command = modulator_V29_command;
+      self->process = modulator_V29_process;
+      self->process_max = modulator_V29_max;
+      self->input_format = IFAX_FORMAT_BITS;
+      self->output_format = IFAX_FORMAT_S16;
    
       priv->w = 0;
       priv->bitstore_size = 0;
@@ -548,6 +615,9 @@
       priv->phase = 0;
       priv->randseq = 0;
       priv->buffer_size = 0;
+      priv->buffer = 0;
+      priv->direct = 0;
+      priv->direct_size = 0;
    
       priv->ReImInsert = FILTSIZELP2400;
       for ( t=0; t < (4*FILTSIZELP2400); t++ )
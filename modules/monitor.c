@@ -0,0 +1,325 @@
+/* $Id$
+******************************************************************************
+
+   Fax program for ISDN.
+   Monitoring of a call to a sound card, file or socket.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHOR(S) BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************
+*/
+
+/* The monitor is a sink for the transmitted and received samples of a
+ * call, as given to it by the linedriver.  It never makes the caller
+ * wait: The samples are handed to a recorder (see <ifax/misc/recorder.h>)
+ * that writes them from a thread of its own, and when whoever listens
+ * is too slow to keep up, the newest samples are dropped and counted.
+ *
+ * The samples may be made fewer before they are queued, by averaging
+ * 'decimate' samples into one, and by mixing the two directions down
+ * to a single channel.  Each direction has a volume of its own.
+ *
+ * The target is one of:
+ *
+ *    unix:<path>   A UNIX stream socket someone is listening on
+ *    <name>.wav    A WAV file
+ *    <device>      A sound card (any character device), set up as OSS
+ *    <name>        Any other file, to get the raw samples
+ *
+ * The module interface is:
+ *
+ *    Input:
+ *       - 16-bit signed samples, transmitted and received interleaved
+ *       - length specifies number of sample pairs
+ *
+ *    Output:
+ *       None
+ *
+ *    Commands supported:
+ *       CMD_MONITOR_VOLUME,tx,rx        (0x10000 is unity, and most)
+ *       CMD_MONITOR_STATS,&sent,&dropped
+ *
+ *    Parameters:
+ *       char *target, int decimate, int mixdown
+ *
+ * Sound cards get the volumes used for monitoring before, the others
+ * unity.  Creating the module fails if the target can't be opened.
+ */
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/ioctl.h>
+#include <linux/soundcard.h>
+
+#include <ifax/ifax.h>
+#include <ifax/types.h>
+#include <ifax/misc/malloc.h>
+#include <ifax/misc/recorder.h>
+#include <ifax/modules/monitor.h>
+
+#define SAMPLERATE	8000
+
+/* Longest time the recorder thread may wait for a socket to take more */
+#define SOCKET_TIMEOUT	1
+
+/* Sample pairs converted at a time */
+#define MONITOR_CHUNK	256
+
+typedef struct {
+
+  struct Recorder *rec;
+  int decimate, mixdown;
+  ifax_sint32 volume[2];        /* Transmitted, received */
+
+  int phase;                    /* Pairs summed for the next output */
+  ifax_sint32 sum[2];
+
+  ifax_sint16 out[2*MONITOR_CHUNK];
+
+} monitor_private;
+
+
+static int open_socket(char *path)
+{
+  struct sockaddr_un addr;
+  struct timeval timeout;
+  int fd;
+
+  if ( strlen(path) >= sizeof(addr.sun_path) ) {
+    errno = ENAMETOOLONG;
+    return -1;
+  }
+
+  if ( (fd = socket(AF_UNIX,SOCK_STREAM,0)) < 0 )
+    return -1;
+
+  memset(&addr,0,sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path,path);
+
+  if ( connect(fd,(struct sockaddr *)&addr,sizeof(addr)) < 0 ) {
+    close(fd);
+    return -1;
+  }
+
+  /* So a listener that stops reading can't hold up the end of a call */
+  timeout.tv_sec = SOCKET_TIMEOUT;
+  timeout.tv_usec = 0;
+  setsockopt(fd,SOL_SOCKET,SO_SNDTIMEO,&timeout,sizeof(timeout));
+
+  return fd;
+}
+
+static int setup_audio(int fd, int channels, int rate)
+{
+  int stereo = channels == 2;
+  int format = AFMT_S16_LE;
+  int smplsize = 16;
+  int err = 0;
+
+  err |= ioctl (fd, SNDCTL_DSP_SPEED, &rate);
+  err |= ioctl (fd, SNDCTL_DSP_STEREO, &stereo);
+  err |= ioctl (fd, SNDCTL_DSP_SAMPLESIZE, &smplsize);
+  err |= ioctl (fd, SNDCTL_DSP_SETFMT, &format);
+
+  return err;
+}
+
+/* Returns 1 if the target is a sound card */
+
+static int open_target(monitor_private *priv, char *target, int channels,
+		       int rate)
+{
+  struct stat st;
+  size_t len = strlen(target);
+  int fd;
+
+  if ( strncmp(target,"unix:",5) == 0 ) {
+    if ( (fd = open_socket(target+5)) >= 0 )
+      priv->rec = recorder_attach(fd,target,channels,rate);
+  } else if ( len > 4 && strcmp(target+len-4,".wav") == 0 ) {
+    priv->rec = recorder_start(target,channels,rate);
+    return 0;
+  } else if ( stat(target,&st) == 0 && S_ISCHR(st.st_mode) ) {
+    if ( (fd = open(target,O_WRONLY)) >= 0 ) {
+      if ( setup_audio(fd,channels,rate) ) {
+	close(fd);
+	fd = -1;
+	errno = EINVAL;
+      } else {
+	priv->rec = recorder_attach(fd,target,channels,rate);
+	return 1;
+      }
+    }
+  } else {
+    if ( (fd = creat(target,0660)) >= 0 )
+      priv->rec = recorder_attach(fd,target,channels,rate);
+  }
+
+  if ( fd < 0 )
+    ifax_dprintf(DEBUG_ERROR,"Monitor %s: %s\n",target,strerror(errno));
+
+  return 0;
+}
+
+static ifax_sint16 clip(ifax_sint32 v)
+{
+  if ( v > 32767 )
+    return 32767;
+  if ( v < -32768 )
+    return -32768;
+  return v;
+}
+
+/* Convert up to MONITOR_CHUNK pairs into 'out', and return the number
+ * of frames made.
+ */
+
+static int convert(monitor_private *priv, ifax_sint16 *src, int pairs)
+{
+  ifax_sint16 *dst = priv->out;
+  ifax_sint32 tx, rx;
+  int t;
+
+  for ( t=0; t < pairs; t++ ) {
+
+    priv->sum[0] += *src++;
+    priv->sum[1] += *src++;
+    if ( ++priv->phase < priv->decimate )
+      continue;
+
+    tx = priv->sum[0] / priv->decimate;
+    rx = priv->sum[1] / priv->decimate;
+    priv->phase = 0;
+    priv->sum[0] = priv->sum[1] = 0;
+
+    tx = (tx * priv->volume[0]) >> 16;
+    rx = (rx * priv->volume[1]) >> 16;
+
+    if ( priv->mixdown ) {
+      *dst++ = clip(tx + rx);
+    } else {
+      *dst++ = clip(tx);
+      *dst++ = clip(rx);
+    }
+  }
+
+  return priv->mixdown ? dst - priv->out : (dst - priv->out) / 2;
+}
+
+static int monitor_handle(ifax_modp self, void *data, size_t length)
+{
+  monitor_private *priv = self->private;
+  ifax_sint16 *src = data;
+  size_t remaining = length;
+  int pairs, frames;
+
+  while ( remaining > 0 ) {
+    pairs = remaining > MONITOR_CHUNK ? MONITOR_CHUNK : remaining;
+    if ( (frames = convert(priv,src,pairs)) > 0 )
+      recorder_write(priv->rec,priv->out,frames);
+    src += 2*pairs;
+    remaining -= pairs;
+  }
+
+  return length;
+}
+
+static int monitor_command(ifax_modp self, int cmd, va_list cmds)
+{
+  monitor_private *priv = self->private;
+  int c, volume;
+
+  switch ( cmd ) {
+
+    case CMD_MONITOR_VOLUME:
+      for ( c=0; c < 2; c++ ) {
+	volume = va_arg(cmds,int);
+	priv->volume[c] = volume < 0 ? 0 : volume > 0x10000 ? 0x10000 : volume;
+      }
+      break;
+
+    case CMD_MONITOR_STATS:
+      *va_arg(cmds,unsigned long *) = priv->rec->written;
+      *va_arg(cmds,unsigned long *) = priv->rec->dropped;
+      break;
+
+    default:
+      return 1;
+  }
+
+  return 0;
+}
+
+/* Waits for the queued samples to be written, so monitoring should be
+ * stopped (the linedriver told to stop) before this is done.
+ */
+
+static void monitor_destroy(ifax_modp self)
+{
+  monitor_private *priv = self->private;
+
+  recorder_stop(priv->rec);
+  free(self->private);
+}
+
+int monitor_construct(ifax_modp self, va_list args)
+{
+  monitor_private *priv;
+  char *target;
+  int card;
+
+  priv = ifax_malloc(sizeof(monitor_private),"Monitor instance");
+  self->private = priv;
+
+  target = va_arg(args,char *);
+  priv->decimate = va_arg(args,int);
+  priv->mixdown = va_arg(args,int);
+
+  if ( priv->decimate < 1 )
+    priv->decimate = 1;
+  if ( priv->decimate > MONITOR_MAXDECIMATE )
+    priv->decimate = MONITOR_MAXDECIMATE;
+
+  card = open_target(priv,target,priv->mixdown ? 1 : 2,
+		     SAMPLERATE/priv->decimate);
+  if ( priv->rec == 0 ) {
+    free(priv);
+    return 1;
+  }
+
+  priv->volume[0] = card ? 0x6000 : 0x10000;
+  priv->volume[1] = card ? 0x8000 : 0x10000;
+
+  self->destroy = monitor_destroy;
+  self->handle_input = monitor_handle;
+  self->command = monitor_command;
+  self->input_format = IFAX_FORMAT_S16;
+  self->output_format = IFAX_FORMAT_UNKNOWN;
+
+  return 0;
+}
@@ -65,10 +65,12 @@
 
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 #include <ifax/ifax.h>
 #include <ifax/types.h>
 #include <ifax/misc/malloc.h>
 #include <ifax/modules/rateconvert.h>
+#include <ifax/modules/bank.h>
 
 
 #define MAXBUFFER 256
@@ -87,26 +89,30 @@ typedef struct {
   ifax_sint32 scale;
   ifax_uint32 rate_factor;      /*  0x10000 * downfactor / upfactor */
   int dry_period;
+  size_t maxinput;              /* Input samples giving MAXBUFFER output */
 
   struct {
     ifax_sint16 *startcoef;
     int count;
   } *seq;
 
-  ifax_sint16 buffer[MAXBUFFER];
-
 } rateconvert_private;
 
 
 
-static int rateconvert_handle(ifax_modp self, void *data, size_t length)
+/* Filter 'length' input samples into 'out', returning the number of
+ * output samples produced.  This is the work-horse of both the usual
+ * 'handle' function and the 'process' method used by pipelines.
+ */
+
+static size_t rateconvert_filter(rateconvert_private *priv, ifax_sint16 *idp,
+				 size_t length, ifax_sint16 *out)
 {
-  rateconvert_private *priv = self->private;
-  ifax_sint16 *idp = data, *dp, *coef, temp;
-  int bp, t, p, k, count;
+  ifax_sint16 *dp, *coef, temp;
+  int t, p, k, count;
+  size_t bp = 0;
   ifax_sint32 sum;
 
-  bp = 0;
   for ( t=0; t < length; t++ ) {
 
     priv->data[priv->storenext++] = *idp++;
@@ -138,25 +144,68 @@ static int rateconvert_handle(ifax_modp self, void *data, size_t length)
       sum = temp * priv->scale;
       temp = sum >> 16;
       
-      priv->buffer[bp++] = temp;
-
-      if ( bp >= MAXBUFFER ) {
-	ifax_handle_input(self->sendto,priv->buffer,MAXBUFFER);
-	bp = 0;
-      }
+      out[bp++] = temp;
     }
   }
 
-  if ( bp > 0 )
-    ifax_handle_input(self->sendto,priv->buffer,bp);
+  return bp;
+}
 
-  return length;
+/* Any 'length' consecutive input samples produce at most this many
+ * output samples.
+ */
+
+static size_t max_output(rateconvert_private *priv, size_t length)
+{
+  return (length*priv->upfactor + priv->downfactor - 1)/priv->downfactor + 1;
 }
 
-static void rateconvert_destroy(ifax_modp self)
+static size_t rateconvert_max(ifax_modp self, size_t length)
+{
+  return max_output(self->private,length);
+}
+
+static size_t rateconvert_process(ifax_modp self, void *in, size_t length,
+				  void *out)
+{
+  return rateconvert_filter(self->private,in,length,out);
+}
+
+static int rateconvert_handle(ifax_modp self, void *data, size_t length)
 {
-  rateconvert_private *priv=(rateconvert_private *)self->private;
+  rateconvert_private *priv = self->private;
+  ifax_sint16 *idp = data;
+  size_t chunk, remaining = length;
+  ifax_buffer *buf;
+
+  /* The output is computed directly into pooled buffers that are
+   * passed on to the next module without copying.
+   */
+
+  while ( remaining > 0 ) {
+
+    chunk = remaining;
+    if ( chunk > priv->maxinput )
+      chunk = priv->maxinput;
+
+    if ( (buf = ifax_buffer_alloc(IFAX_FORMAT_S16,MAXBUFFER)) == 0 )
+      return length - remaining;
 
+    buf->length = rateconvert_filter(priv,idp,chunk,buf->data);
+    if ( buf->length > 0 )
+      ifax_handle_buffer(self->sendto,buf);
+    else
+      ifax_buffer_unref(buf);
+
+    idp += chunk;
+    remaining -= chunk;
+  }
+
+  return length;
+}
+
+static void free_filter(rateconvert_private *priv)
+{
   if ( priv->coefs != 0 )
     free(priv->coefs);
 
@@ -168,13 +217,18 @@ static void rateconvert_destroy(ifax_modp self)
 
   if ( priv->subfilter != 0 )
     free(priv->subfilter);
+}
 
+static void rateconvert_destroy(ifax_modp self)
+{
+  free_filter(self->private);
   free(self->private);
 }
 
-static void rateconvert_demand(ifax_modp self, size_t demand)
+/* Number of input samples needed to produce 'demand' output samples */
+
+static size_t input_needed(rateconvert_private *priv, size_t demand)
 {
-  rateconvert_private *priv = self->private;
   unsigned int needed;
 
   needed = demand * priv->rate_factor;
@@ -183,7 +237,12 @@ static void rateconvert_demand(ifax_modp self, size_t demand)
   if ( needed < priv->dry_period )
     needed = priv->dry_period;
 
-  ifax_handle_demand(self->recvfrom,needed);
+  return needed;
+}
+
+static void rateconvert_demand(ifax_modp self, size_t demand)
+{
+  ifax_handle_demand(self->recvfrom,input_needed(self->private,demand));
 }
 
 static int rateconvert_command(ifax_modp self, int cmd, va_list cmds)
@@ -192,21 +251,16 @@ static int rateconvert_command(ifax_modp self, int cmd, va_list cmds)
 }
 
 
-int rateconvert_construct(ifax_modp self, va_list args )
+/* Set up the filter from the constructor parameters.  This is shared
+ * by the single-channel and the bank version of the module.
+ */
+
+static int setup_filter(rateconvert_private *priv, va_list args)
 {
-  rateconvert_private *priv;
   int t, k, n, decimate;
   ifax_sint16 *filtercoef, *dp, *sp;
   int dry;
 
-  priv = ifax_malloc(sizeof(rateconvert_private),"Rateconverter instance");
-  self->private = priv;
-
-  self->destroy = rateconvert_destroy;
-  self->handle_input = rateconvert_handle;
-  self->handle_demand = rateconvert_demand;
-  self->command = rateconvert_command;
-
   priv->upfactor = va_arg(args,int);
   priv->downfactor = va_arg(args,int);
   priv->filtersize = va_arg(args,int);
@@ -296,5 +350,196 @@ int rateconvert_construct(ifax_modp self, va_list args )
 
   priv->rate_factor = (0x10000 * priv->downfactor) / priv->upfactor;
 
+  priv->maxinput = 1;
+  while ( max_output(priv,priv->maxinput+1) <= MAXBUFFER )
+    priv->maxinput++;
+
+  return 0;
+}
+
+int rateconvert_construct(ifax_modp self, va_list args )
+{
+  rateconvert_private *priv;
+
+  priv = ifax_malloc(sizeof(rateconvert_private),"Rateconverter instance");
+  self->private = priv;
+
+  self->destroy = rateconvert_destroy;
+  self->handle_input = rateconvert_handle;
+  self->handle_demand = rateconvert_demand;
+  self->command = rateconvert_command;
+  self->process = rateconvert_process;
+  self->process_max = rateconvert_max;
+  self->input_format = IFAX_FORMAT_S16;
+  self->output_format = IFAX_FORMAT_S16;
+
+  return setup_filter(priv,args);
+}
+
+
+/* The bank version of the rate converter does the same filtering for
+ * several channels.  The filter and its sequencing is shared, and the
+ * sample history is stored with the samples of all channels for a
+ * given time side by side.  The inner loop runs over the channels, so
+ * each filter coeficient is fetched once for all of them, and the
+ * compiler is free to do several channels at a time.
+ *
+ * Parameters are:
+ *      int       number of channels
+ *      ...       followed by the parameters of the normal version
+ */
+
+typedef struct {
+
+  ifax_bank bank;
+  rateconvert_private filter;	/* Filter setup; 'data' is unused */
+  ifax_sint16 *history;		/* [subfiltsize][channels] */
+  ifax_sint32 *sum;		/* [channels] */
+  ifax_sint16 *output;		/* [maxinput*upfactor][channels] */
+
+} rateconvert_bank_private;
+
+
+static size_t bank_filter(rateconvert_bank_private *bp, ifax_sint16 *in,
+			  size_t frames, ifax_sint16 *out)
+{
+  rateconvert_private *priv = &bp->filter;
+  int channels = bp->bank.channels;
+  ifax_sint16 *dp, *coef, h, temp;
+  ifax_sint32 *sum = bp->sum, s;
+  int t, p, k, c, count;
+  size_t produced = 0;
+
+  for ( t=0; t < frames; t++ ) {
+
+    memcpy(&bp->history[priv->storenext*channels],in,
+	   channels*sizeof(ifax_sint16));
+    in += channels;
+    if ( ++priv->storenext >= priv->subfiltsize )
+      priv->storenext = 0;
+
+    coef  = priv->seq[priv->next_seq].startcoef;
+    count = priv->seq[priv->next_seq].count;
+    if ( ++priv->next_seq >= priv->seq_size )
+      priv->next_seq = 0;
+
+    for ( p=0; p < count; p++ ) {
+
+      for ( c=0; c < channels; c++ )
+	sum[c] = 0;
+
+      dp = &bp->history[priv->storenext*channels];
+      k = priv->subfiltsize - priv->storenext;
+      while ( k-- ) {
+	h = *coef++;
+	for ( c=0; c < channels; c++ )
+	  sum[c] += dp[c] * h;
+	dp += channels;
+      }
+
+      dp = &bp->history[0];
+      k = priv->storenext;
+      while ( k-- ) {
+	h = *coef++;
+	for ( c=0; c < channels; c++ )
+	  sum[c] += dp[c] * h;
+	dp += channels;
+      }
+
+      for ( c=0; c < channels; c++ ) {
+	temp = sum[c] >> 15;
+	s = temp * priv->scale;
+	out[c] = s >> 16;
+      }
+
+      out += channels;
+      produced++;
+    }
+  }
+
+  return produced;
+}
+
+static int rateconvert_bank_handle(ifax_modp self, void *data, size_t length)
+{
+  rateconvert_bank_private *bp = self->private;
+  ifax_sint16 *in = data;
+  size_t chunk, produced, remaining = length;
+
+  while ( remaining > 0 ) {
+    chunk = remaining;
+    if ( chunk > bp->filter.maxinput )
+      chunk = bp->filter.maxinput;
+    produced = bank_filter(bp,in,chunk,bp->output);
+    bank_output(self,&bp->bank,bp->output,produced,sizeof(ifax_sint16));
+    in += chunk * bp->bank.channels;
+    remaining -= chunk;
+  }
+
+  return length;
+}
+
+static void rateconvert_bank_demand(ifax_modp self, size_t demand)
+{
+  rateconvert_bank_private *bp = self->private;
+
+  ifax_handle_demand(self->recvfrom,input_needed(&bp->filter,demand));
+}
+
+static int rateconvert_bank_command(ifax_modp self, int cmd, va_list cmds)
+{
+  rateconvert_bank_private *bp = self->private;
+
+  return bank_command(&bp->bank,cmd,cmds);
+}
+
+static void rateconvert_bank_destroy(ifax_modp self)
+{
+  rateconvert_bank_private *bp = self->private;
+
+  bank_destroy(&bp->bank);
+  free_filter(&bp->filter);
+  free(bp->history);
+  free(bp->sum);
+  free(bp->output);
+  free(self->private);
+}
+
+int rateconvert_bank_construct(ifax_modp self, va_list args)
+{
+  rateconvert_bank_private *bp;
+  int channels;
+
+  bp = ifax_malloc(sizeof(rateconvert_bank_private),
+		   "Rateconverter bank instance");
+  self->private = bp;
+
+  self->destroy = rateconvert_bank_destroy;
+  self->handle_input = rateconvert_bank_handle;
+  self->handle_demand = rateconvert_bank_demand;
+  self->command = rateconvert_bank_command;
+
+  channels = va_arg(args,int);
+  if ( channels < 1 ) {
+    free(bp);
+    return 1;
+  }
+  bank_initialize(&bp->bank,channels);
+
+  if ( setup_filter(&bp->filter,args) ) {
+    bank_destroy(&bp->bank);
+    free(bp);
+    return 1;
+  }
+
+  bp->history = ifax_malloc(sizeof(*bp->history)*channels*
+			    bp->filter.subfiltsize,
+			    "Rateconverter bank sample history");
+  bp->sum = ifax_malloc(sizeof(*bp->sum)*channels,
+			"Rateconverter bank accumulators");
+  bp->output = ifax_malloc(sizeof(*bp->output)*channels*
+			   max_output(&bp->filter,bp->filter.maxinput),
+			   "Rateconverter bank output");
+
   return 0;
 }
@@ -44,6 +44,7 @@
 
 
 #include <stdarg.h>
+#include <string.h>
 #include <ifax/ifax.h>
 #include <ifax/types.h>
 #include <ifax/misc/malloc.h>
@@ -57,11 +58,36 @@ typedef struct {
   int scramble_ones;
   ifax_uint32 state;
   void (*mode)(ifax_uint8 *, ifax_uint8 *, ifax_uint32 *, size_t);
-  ifax_uint8 buffer[MAXBUFFER];
 
 } scrambler_private;
 
 
+/* Load and store 64 bits, the first in bit 0 of the first byte.  On a
+ * little-endian machine that is the memory order, and a memcpy of the
+ * eight bytes becomes a single (unaligned) load or store.
+ */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+#define GET_WORD64(w,src)	memcpy(&(w),(src),8)
+#define PUT_WORD64(dst,w)	memcpy((dst),&(w),8)
+
+#else
+
+#define GET_WORD64(w,src) \
+  ((w) = (ifax_uint64)(src)[0] | (ifax_uint64)(src)[1]<<8 | \
+   (ifax_uint64)(src)[2]<<16 | (ifax_uint64)(src)[3]<<24 | \
+   (ifax_uint64)(src)[4]<<32 | (ifax_uint64)(src)[5]<<40 | \
+   (ifax_uint64)(src)[6]<<48 | (ifax_uint64)(src)[7]<<56)
+
+#define PUT_WORD64(dst,w) \
+  ((dst)[0] = (w), (dst)[1] = (w)>>8, (dst)[2] = (w)>>16, \
+   (dst)[3] = (w)>>24, (dst)[4] = (w)>>32, (dst)[5] = (w)>>40, \
+   (dst)[6] = (w)>>48, (dst)[7] = (w)>>56)
+
+#endif
+
+
 /* Function 'scramble_V29' is used by V.29 and V.17 modulation.
  *
  * Scramble a series of bits from source (src) to destination (dst)
@@ -69,17 +95,39 @@ typedef struct {
  * in bits.  First bit to pass through the scrambling is bit 0
  * of src[0], and the first bit to pop out of the scrambler is
  * bit 0 of dst[0].
+ *
+ * The state holds the last 23 bits out, the latest in bit 22.  Each
+ * bit out is the bit in xor'ed with the ones 18 and 23 bits earlier,
+ * so up to 18 bits can be done at a time from the state alone.  For
+ * 64 bits at a time, the bits that depend on earlier bits of the same
+ * word are sorted out by multiplying with 1+E+E^2+E^3, E being the
+ * shifts by 18 and 23:  The bits coming from E^4 are more than 64
+ * bits away, and (1+E)(1+E^2) is the same as 1+E+E^2+E^3 when adding
+ * bits by xor, giving only two rounds of shifts.
  */
 
-static void scramble_V29(ifax_uint8 *src, ifax_uint8 *dst,
-			 ifax_uint32 *state, size_t size)
+void scramble_V29(ifax_uint8 *src, ifax_uint8 *dst,
+		  ifax_uint32 *state, size_t size)
 {
   ifax_uint8 next, src_data, dst_data, mask;
   ifax_uint32 st;
+  ifax_uint64 w;
 
   st = *state;
 
-  /* Scramble bytewise first, since it is so easy */
+  while ( size >= 64 ) {
+    size -= 64;
+    GET_WORD64(w,src);
+    w ^= st ^ (st>>5);
+    w ^= (w<<18) ^ (w<<23);
+    w ^= (w<<36) ^ (w<<46);
+    PUT_WORD64(dst,w);
+    st = w >> 41;
+    src += 8;
+    dst += 8;
+  }
+
+  /* Scramble bytewise next, since it is so easy */
 
   while ( size >= 8 ) {
     size -= 8;
@@ -96,6 +144,7 @@ static void scramble_V29(ifax_uint8 *src, ifax_uint8 *dst,
     mask = 1;
     while ( size-- ) {
       next = (st ^ (st>>5) ^ src_data) & 1;
+      src_data >>= 1;
       st = (next<<22) | (st>>1);
       if ( next )
 	dst_data |= mask;
@@ -119,15 +168,28 @@ static void scramble_V29(ifax_uint8 *src, ifax_uint8 *dst,
  * state will be established and communication continues.
  */
 
-static void descramble_V29(ifax_uint8 *src, ifax_uint8 *dst,
-			   ifax_uint32 *state, size_t size)
+void descramble_V29(ifax_uint8 *src, ifax_uint8 *dst,
+		    ifax_uint32 *state, size_t size)
 {
   ifax_uint8 xor, input, src_data, dst_data, mask;
   ifax_uint32 st;
+  ifax_uint64 w, out;
 
   st = *state;
 
-  /* Descramble bytewise first */
+  /* With no feedback, 64 bits at a time is straight forward */
+
+  while ( size >= 64 ) {
+    size -= 64;
+    GET_WORD64(w,src);
+    out = w ^ (w<<18) ^ (w<<23) ^ st ^ (st>>5);
+    PUT_WORD64(dst,out);
+    st = w >> 41;
+    src += 8;
+    dst += 8;
+  }
+
+  /* Descramble bytewise next */
 
   while ( size >= 8 ) {
     size -= 8;
@@ -146,6 +208,7 @@ static void descramble_V29(ifax_uint8 *src, ifax_uint8 *dst,
     while ( size-- ) {
       xor = (st ^ (st>>5)) & 1;
       input = src_data & 1;
+      src_data >>= 1;
       st = (input<<22) | (st>>1);
       if ( input ^ xor )
 	dst_data |= mask;
@@ -200,13 +263,16 @@ int scrambler_handle(ifax_modp self, void *data, size_t length)
   scrambler_private *priv = self->private;
   size_t chunk, remaining = length;
   ifax_uint8 *src = data;
+  ifax_buffer *buf;
 
   while ( remaining > 0 ) {
     chunk = remaining;
     if ( chunk > (MAXBUFFER*8) )
       chunk = (MAXBUFFER*8);
-    (*priv->mode)(src,priv->buffer,&priv->state,chunk);
-    ifax_handle_input(self->sendto,priv->buffer,chunk);
+    if ( (buf = ifax_buffer_alloc(IFAX_FORMAT_BITS,chunk)) == 0 )
+      break;
+    (*priv->mode)(src,buf->data,&priv->state,chunk);
+    ifax_handle_buffer(self->sendto,buf);
     src += MAXBUFFER;
     remaining -= chunk;
   }
@@ -214,10 +280,45 @@ int scrambler_handle(ifax_modp self, void *data, size_t length)
   return length;
 }
 
+/* Buffers we are the sole owner of are (de)scrambled in place.  Both
+ * scramble_V29 and descramble_V29 read each byte before writing it, so
+ * using the same source and destination is safe.
+ */
+
+static int scrambler_handle_buffer(ifax_modp self, ifax_buffer *buf)
+{
+  scrambler_private *priv = self->private;
+  size_t length = buf->length;
+
+  if ( (buf = ifax_buffer_writable(buf)) == 0 )
+    return 0;
+
+  (*priv->mode)(buf->data,buf->data,&priv->state,length);
+  ifax_handle_buffer(self->sendto,buf);
+
+  return length;
+}
+
+static size_t scrambler_process(ifax_modp self, void *in, size_t length,
+				void *out)
+{
+  scrambler_private *priv = self->private;
+
+  (*priv->mode)(in,out,&priv->state,length);
+
+  return length;
+}
+
+static size_t scrambler_max(ifax_modp self, size_t length)
+{
+  return length;
+}
+
 static void scrambler_demand(ifax_modp self, size_t demand)
 {
   scrambler_private *priv = self->private;
   size_t do_bits, remaining = demand;
+  ifax_buffer *buf;
 
   static ifax_uint8 ones[] = { 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff };
 
@@ -226,8 +327,10 @@ static void scrambler_demand(ifax_modp self, size_t demand)
       do_bits = 64;
       if ( do_bits > remaining )
 	do_bits = remaining;
-      (*priv->mode)(ones,priv->buffer,&priv->state,do_bits);
-      ifax_handle_input(self->sendto,priv->buffer,do_bits);
+      if ( (buf = ifax_buffer_alloc(IFAX_FORMAT_BITS,do_bits)) == 0 )
+	return;
+      (*priv->mode)(ones,buf->data,&priv->state,do_bits);
+      ifax_handle_buffer(self->sendto,buf);
       remaining -= do_bits;
     }
   } else {
@@ -250,8 +353,13 @@ int scrambler_construct(ifax_modp self,va_list args)
 
   self->destroy	=  scrambler_destroy;
   self->handle_input = scrambler_handle;
+  self->handle_buffer = scrambler_handle_buffer;
   self->handle_demand = scrambler_demand;
   self->command	= scrambler_command;
+  self->process = scrambler_process;
+  self->process_max = scrambler_max;
+  self->input_format = IFAX_FORMAT_BITS;
+  self->output_format = IFAX_FORMAT_BITS;
 
   priv->state=0;
   priv->scramble_ones = 0;
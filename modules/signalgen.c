@@ -63,11 +63,6 @@
 
 typedef struct {
 
-  union {
-    ifax_sint16 s16[BUFFERSIZE];
-    ifax_uint8  u8[BUFFERSIZE];
-  } buffer;
-
   int mode;
 
   ifax_uint16 phaseinc, w;
@@ -81,8 +76,13 @@ static void make_signal(ifax_modp self, size_t demand)
   signalgen_private *priv = self->private;
   size_t remaining = demand;
   int chunk, chunkbits, t;
-  signed int sp;
-  unsigned int up;
+  ifax_buffer *buf;
+  ifax_sint16 *s16;
+  ifax_uint8 *u8;
+
+  /* The signal is generated directly into pooled buffers which are
+   * handed on to the next module without any copying.
+   */
 
   switch ( priv->mode ) {
 
@@ -91,14 +91,11 @@ static void make_signal(ifax_modp self, size_t demand)
 	chunk = remaining;
 	if ( chunk > BUFFERSIZE )
 	  chunk = BUFFERSIZE;
-	for ( t=0; t < chunk; t++ ) {
-	  sp = intsin(priv->w) * priv->scale;
-	  priv->w += priv->phaseinc;
-	  up = sp;
-	  up >>= 16;
-	  priv->buffer.s16[t] = up;
-	}
-	ifax_handle_input(self->sendto,priv->buffer.s16,chunk);
+	if ( (buf = ifax_buffer_alloc(IFAX_FORMAT_S16,chunk)) == 0 )
+	  return;
+	s16 = buf->data;
+	priv->w = intsin_block(s16,chunk,priv->w,priv->phaseinc,priv->scale);
+	ifax_handle_buffer(self->sendto,buf);
 	remaining -= chunk;
       }
       break;
@@ -112,11 +109,14 @@ static void make_signal(ifax_modp self, size_t demand)
 	    chunkbits = chunk * 8;
 	  }
 
+	  if ( (buf = ifax_buffer_alloc(IFAX_FORMAT_BITS,chunkbits)) == 0 )
+	    return;
+	  u8 = buf->data;
 	  for ( t=0; t < chunk; t++ ) {
-	    priv->buffer.u8[t] = rand() & 0xff;
+	    u8[t] = rand() & 0xff;
 	  }
 
-	  ifax_handle_input(self->sendto,priv->buffer.s16,chunkbits);
+	  ifax_handle_buffer(self->sendto,buf);
 	  remaining -= chunkbits;
       }
       break;
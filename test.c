@@ -26,15 +26,23 @@
 ******************************************************************************
 */
 
+#define _GNU_SOURCE		/* posix_openpt() and friends */
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
+#include <math.h>
 #include <assert.h>
 
 #include <unistd.h>
 #include <fcntl.h>
+#include <termios.h>
+#include <sched.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 
 #include <ifax/ifax.h>
 
@@ -47,6 +55,22 @@
 #include <ifax/modules/signalgen.h>
 #include <ifax/modules/linedriver.h>
 #include <ifax/modules/V.29_demod.h>
+#include <ifax/modules/channel.h>
+#include <ifax/modules/monitor.h>
+#include <ifax/modules/hdlc-framing.h>
+#include <ifax/modules/decode_hdlc.h>
+#include <ifax/modules/bank.h>
+#include <ifax/alaw.h>
+#include <ifax/misc/hardware-driver.h>
+#include <ifax/misc/eventloop.h>
+#include <ifax/misc/iobuffer.h>
+#include <ifax/misc/isdnline.h>
+#include <ifax/misc/dspthread.h>
+#include <ifax/misc/globals.h>
+#include <ifax/misc/readconfig.h>
+#include <ifax/misc/recorder.h>
+#include <ifax/G3/initialize.h>
+#include <ifax/highlevel/commandparse.h>
 
 
 int send_to_audio_construct (ifax_modp self, va_list args);
@@ -86,6 +110,12 @@ ifax_module_id IFAX_LINEDRIVER;
 ifax_module_id IFAX_SIGNALGEN;
 ifax_module_id IFAX_V29DEMOD;
 ifax_module_id IFAX_SYNCBIT;
+ifax_module_id IFAX_CHANNEL;
+ifax_module_id IFAX_MONITOR;
+ifax_module_id IFAX_ENCODER_HDLC;
+ifax_module_id IFAX_FSKDEMOD_BANK;
+ifax_module_id IFAX_MODULATORV21_BANK;
+ifax_module_id IFAX_RATECONVERT_BANK;
 
 void
 setup_all_modules (void)
@@ -109,6 +139,12 @@ setup_all_modules (void)
   IFAX_LINEDRIVER = ifax_register_module_class ("Linedriver", linedriver_construct);
   IFAX_V29DEMOD = ifax_register_module_class ("V.29 Demodulator", V29demod_construct);
   IFAX_SYNCBIT = ifax_register_module_class("Bit syncronization",syncbit_construct);
+  IFAX_CHANNEL = ifax_register_module_class ("Channel simulator", channel_construct);
+  IFAX_MONITOR = ifax_register_module_class ("Monitor", monitor_construct);
+  IFAX_ENCODER_HDLC = ifax_register_module_class ("HDLC encoder", encoder_hdlc_construct);
+  IFAX_FSKDEMOD_BANK = ifax_register_module_class ("FSK demodulator bank", fskdemod_bank_construct);
+  IFAX_MODULATORV21_BANK = ifax_register_module_class ("V.21 Modulator bank", modulator_V21_bank_construct);
+  IFAX_RATECONVERT_BANK = ifax_register_module_class ("Sample-rate converter bank", rateconvert_bank_construct);
 }
 
 void
@@ -323,7 +359,8 @@ test_linedriver (void)
 
   /* Feed the signal to the line-driver for transmission */
   linedriver = ifax_create_module (IFAX_LINEDRIVER);
-  ifax_command (linedriver, CMD_LINEDRIVER_AUDIO);
+  ifax_command (linedriver, CMD_LINEDRIVER_AUDIO,
+		ifax_create_module (IFAX_MONITOR, "/dev/dsp", 1, 0));
 
   signalgen->sendto = scrambler;
   scrambler->recvfrom = signalgen;
@@ -373,7 +410,8 @@ test_v29demod (void)
 
   /* Feed the signal to the line-driver for transmission */
   linedriver = ifax_create_module (IFAX_LINEDRIVER);
-  ifax_command (linedriver, CMD_LINEDRIVER_AUDIO);
+  ifax_command (linedriver, CMD_LINEDRIVER_AUDIO,
+		ifax_create_module (IFAX_MONITOR, "/dev/dsp", 1, 0));
 
   /* V.29 Demodulation */
   v29demod = ifax_create_module (IFAX_V29DEMOD);
@@ -449,11 +487,14 @@ void test_new_v21_demod(void)
     FILE *fp;
     ifax_sint16 samples[2];
 
-    if ( (fp=fopen("/tmp/modem.dat","r")) == 0 ) {
-      fprintf(stderr,"Can't open /tmp/modem.dat\n");
+    if ( (fp=fopen("/tmp/modem.wav","r")) == 0 ) {
+      fprintf(stderr,"Can't open /tmp/modem.wav\n");
       exit(1);
     }
 
+    /* Skip the WAV header of the recording */
+    fseek(fp,44,SEEK_SET);
+
     while ( fread(&samples[0],4,1,fp) == 1 ) {
       samples[1] *= 30;    /* Patch; logged signal is too weak */
       ifax_handle_input(v21demod,&samples[0],1);
@@ -464,6 +505,3058 @@ void test_new_v21_demod(void)
 }
 
 
+/* Bit error rate and CPU usage of the demodulators against the signal
+ * to noise ratio, using the channel simulator.  The modulated signal is
+ * made once and stored, and for each noise level it is run through the
+ * channel first, so only the demodulator itself is timed.
+ *
+ * The V.21 demodulator is fed scrambled ones.  The received bits are
+ * descrambled by 'bitcheck', so every bit should come out as a one no
+ * matter where the bit synchronizer starts.  Note that the descrambler
+ * turns each bit error on the line into three.  The V.29 demodulator
+ * does not deliver any bits yet, so only its CPU usage is shown.
+ */
+
+#define CURVE_SAMPLES 80000
+
+static ifax_sint16 curve_clean[CURVE_SAMPLES], curve_noisy[CURVE_SAMPLES];
+static size_t curve_count;
+static long curve_bits, curve_errors;
+static ifax_uint32 curve_state;
+
+static int capture_handle (ifax_modp self, void *data, size_t length)
+{
+  ifax_sint16 *dst = self->private;
+
+  if (length > CURVE_SAMPLES - curve_count)
+    length = CURVE_SAMPLES - curve_count;
+  memcpy (&dst[curve_count], data, length * sizeof (ifax_sint16));
+  curve_count += length;
+
+  return length;
+}
+
+static int bitcheck_handle (ifax_modp self, void *data, size_t length)
+{
+  char *bits = data;
+  ifax_uint32 in;
+  size_t t;
+
+  for (t = 0; t < length; t++)
+    {
+      in = bits[t] & 1;
+      if (++curve_bits > 50
+	  && ((in ^ curve_state ^ (curve_state >> 5)) & 1) != 1)
+	curve_errors++;
+      curve_state = ((in << 22) | (curve_state >> 1)) & 0x7fffff;
+    }
+
+  return length;
+}
+
+static int curve_command (ifax_modp self, int cmd, va_list cmds)
+{
+  return 1;
+}
+
+static void curve_destroy (ifax_modp self)
+{
+}
+
+static int capture_construct (ifax_modp self, va_list args)
+{
+  self->private = va_arg (args, ifax_sint16 *);
+  self->handle_input = capture_handle;
+  self->command = curve_command;
+  self->destroy = curve_destroy;
+  return 0;
+}
+
+static int bitcheck_construct (ifax_modp self, va_list args)
+{
+  self->handle_input = bitcheck_handle;
+  self->command = curve_command;
+  self->destroy = curve_destroy;
+  return 0;
+}
+
+/* Level in dBm0 of the stored clean signal */
+
+static double curve_level (void)
+{
+  double power = 0.0;
+  size_t t;
+
+  for (t = 0; t < curve_count; t++)
+    power += curve_clean[t] * (double) curve_clean[t];
+
+  return 10.0 * log10 (power / curve_count / (15889.0 * 15889.0));
+}
+
+/* Run the stored signal through the channel, with noise 'snr' dB below
+ * it, and A-law quantization as on the ISDN line.
+ */
+
+static void curve_channel (ifax_modp channel, int snr, double level)
+{
+  ifax_command (channel, CMD_GENERIC_INITIALIZE);
+  ifax_command (channel, CMD_CHANNEL_SEED, 4711);
+  ifax_command (channel, CMD_CHANNEL_NOISE, (int) floor (level - snr + 0.5));
+  ifax_command (channel, CMD_CHANNEL_ALAW, 1);
+
+  curve_count = 0;
+  ifax_handle_input (channel, curve_clean, CURVE_SAMPLES);
+}
+
+static double curve_time (ifax_modp first)
+{
+  struct timeval start, end;
+  size_t t;
+
+  gettimeofday (&start, 0);
+  for (t = 0; t < CURVE_SAMPLES; t += 160)
+    ifax_handle_input (first, &curve_noisy[t], 160);
+  gettimeofday (&end, 0);
+
+  return (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6;
+}
+
+void
+test_channel_curves (void)
+{
+  ifax_modp scrambler, modulator, rateconvert, capture;
+  ifax_modp demod, sync, bitcheck, signalgen, channel;
+  ifax_module_id CAPTURE, BITCHECK;
+  double level, secs;
+  int snr;
+
+  CAPTURE = ifax_register_module_class ("Capture", capture_construct);
+  BITCHECK = ifax_register_module_class ("Bit checker", bitcheck_construct);
+
+  channel = ifax_create_module (IFAX_CHANNEL);
+  ifax_connect (channel, ifax_create_module (CAPTURE, curve_noisy));
+
+  /* V.21 channel 2 carrying scrambled ones, at 8000 samples/s */
+  scrambler = ifax_create_module (IFAX_SCRAMBLER);
+  ifax_command (scrambler, CMD_GENERIC_SCRAMBLEONES);
+  modulator = ifax_create_module (IFAX_MODULATORV21, 2);
+  rateconvert = ifax_create_module (IFAX_RATECONVERT, 10, 9, 250,
+				    rate_7k2_8k_1, 0x10000);
+  capture = ifax_create_module (CAPTURE, curve_clean);
+  ifax_connect (scrambler, modulator);
+  ifax_connect (modulator, rateconvert);
+  ifax_connect (rateconvert, capture);
+
+  curve_count = 0;
+  while (curve_count < CURVE_SAMPLES)
+    ifax_handle_demand (rateconvert, 256);
+  level = curve_level ();
+
+  printf ("V.21 at %.1f dBm0, %d samples\n", level, CURVE_SAMPLES);
+  printf ("  SNR   bits  BER (x3)  CPU (x real time)\n");
+
+  for (snr = 24; snr >= -9; snr -= 3)
+    {
+      curve_channel (channel, snr, level);
+
+      demod = ifax_create_module (IFAX_FSKDEMOD, 8000, 1650, 1850, 300);
+      sync = ifax_create_module (IFAX_SYNCBIT, 8000, 300);
+      bitcheck = ifax_create_module (BITCHECK);
+      ifax_connect (demod, sync);
+      ifax_connect (sync, bitcheck);
+
+      curve_bits = curve_errors = 0;
+      curve_state = 0;
+      secs = curve_time (demod);
+
+      printf ("  %3d  %5ld  %.2e  %.0f\n", snr, curve_bits,
+	      curve_bits > 50 ? (double) curve_errors / (curve_bits - 50) : 1.0,
+	      CURVE_SAMPLES / 8000.0 / secs);
+    }
+
+  /* V.29 carrying random data, at 7200 samples/s like 'test_v29demod' */
+  signalgen = ifax_create_module (IFAX_SIGNALGEN);
+  ifax_command (signalgen, CMD_SIGNALGEN_RNDBITS);
+  scrambler = ifax_create_module (IFAX_SCRAMBLER);
+  modulator = ifax_create_module (IFAX_MODULATORV29);
+  capture = ifax_create_module (CAPTURE, curve_clean);
+  ifax_connect (signalgen, scrambler);
+  ifax_connect (scrambler, modulator);
+  ifax_connect (modulator, capture);
+  ifax_command (modulator, CMD_GENERIC_INITIALIZE);
+
+  curve_count = 0;
+  while (curve_count < CURVE_SAMPLES)
+    ifax_handle_demand (modulator, 256);
+  level = curve_level ();
+
+  printf ("V.29 at %.1f dBm0, %d samples\n", level, CURVE_SAMPLES);
+  printf ("  SNR  CPU (x real time)\n");
+
+  for (snr = 30; snr >= 0; snr -= 3)
+    {
+      curve_channel (channel, snr, level);
+      demod = ifax_create_module (IFAX_V29DEMOD);
+      secs = curve_time (demod);
+      printf ("  %3d  %.0f\n", snr, CURVE_SAMPLES / 7200.0 / secs);
+    }
+}
+
+
+/* Accuracy and speed of 'intatan', 'intmag' and 'intsqrt', against the
+ * tables they used to read (made here the way their generators made
+ * them) and against the C library.  The errors are in units of the
+ * result.  The speed is measured both back to back, and with 256 KB
+ * of other memory written between each block of vectors, which pushes
+ * a table out of the caches the way the rest of a demodulator would.
+ */
+
+#define KERNEL_VECTORS 256
+#define KERNEL_ROUNDS 4000
+#define KERNEL_FLUSH (256*1024)
+
+static short old_atantbl[32769];
+static short old_sqrttbl[32768];
+
+static unsigned short
+old_intatan (short y, short x)
+{
+  short abs_y = (y < 0) ? -y : y, abs_x = (x < 0) ? -x : x, res;
+
+  if (abs_y <= abs_x)
+    res = old_atantbl[(abs_y << 15) / abs_x];
+  else
+    res = 0x4000 - old_atantbl[(abs_x << 15) / abs_y];
+
+  if (x > 0)
+    res = (y > 0) ? res : (0xFFFF - res);
+  else
+    res = (y > 0) ? (0x8000 - res) : (0x8000 + res);
+
+  return res;
+}
+
+/* Distance between two angles, in units of the full circle / 65536 */
+
+static double
+angle_error (double a, double b)
+{
+  double d = fmod (a - b, 65536.0);
+
+  if (d > 32768.0)
+    d -= 65536.0;
+  if (d < -32768.0)
+    d += 65536.0;
+  return fabs (d);
+}
+
+/* Nanoseconds per vector: 'how' is 0 for the old table, 1 for
+ * 'intatan', 2 for 'intatan_block' and 3 for nothing but the flush.
+ * The best of a few tries is taken, as the flushing makes it noisy.
+ */
+
+static double
+kernel_time (int how, char *flush, short *y, short *x, unsigned short *angle)
+{
+  struct timeval start, end;
+  double best = 1e30, ns;
+  int tries, r, t;
+
+  for (tries = 0; tries < 5; tries++)
+    {
+      gettimeofday (&start, 0);
+      for (r = 0; r < KERNEL_ROUNDS; r++)
+	{
+	  if (flush != 0)
+	    memset (flush, r, KERNEL_FLUSH);
+	  switch (how)
+	    {
+	    case 0:
+	      for (t = 0; t < KERNEL_VECTORS; t++)
+		angle[t] = old_intatan (y[t], x[t]);
+	      break;
+	    case 1:
+	      for (t = 0; t < KERNEL_VECTORS; t++)
+		angle[t] = intatan (y[t], x[t]);
+	      break;
+	    case 2:
+	      intatan_block (y, x, angle, 0, KERNEL_VECTORS);
+	      break;
+	    }
+	}
+      gettimeofday (&end, 0);
+
+      ns = ((end.tv_sec - start.tv_sec) * 1e6
+	    + (end.tv_usec - start.tv_usec)) * 1000.0;
+      if (ns < best)
+	best = ns;
+    }
+
+  return best / KERNEL_ROUNDS / KERNEL_VECTORS;
+}
+
+void
+test_atan_kernels (void)
+{
+  static char *names[3] = { "old table", "intatan", "intatan_block" };
+  static short y[KERNEL_VECTORS], x[KERNEL_VECTORS];
+  static unsigned short angle[KERNEL_VECTORS];
+  double exact, err, max_new = 0, max_old = 0, max_mag = 0, flushing;
+  int diff, max_diff = 0, max_block = 0, i, j;
+  short by, bx;
+  unsigned short ba;
+  char *flush;
+
+  for (i = 0; i <= 32768; i++)
+    old_atantbl[i] = (short) (atan ((float) i / 32768) / atan (1) * 8192);
+  for (i = 0; i < 32767; i++)
+    old_sqrttbl[i] = (short) (sqrt ((float) i / 32768) * 32768);
+
+  /* Vectors on a grid over the whole plane.  The table version can't
+   * take the zero vector or -32768.
+   */
+  for (i = -32767; i < 32768; i += 97)
+    for (j = -32767; j < 32768; j += 89)
+      {
+	if (i == 0 && j == 0)
+	  continue;
+	exact = atan2 (i, j) / (2 * M_PI) * 65536.0;
+	err = angle_error (intatan (i, j), exact);
+	if (err > max_new)
+	  max_new = err;
+	err = angle_error (old_intatan (i, j), exact);
+	if (err > max_old)
+	  max_old = err;
+	err = fabs (intmag (i, j) - sqrt ((double) i * i + (double) j * j));
+	if (err > max_mag)
+	  max_mag = err;
+	by = i;
+	bx = j;
+	intatan_block (&by, &bx, &ba, 0, 1);
+	err = angle_error (ba, intatan (i, j));
+	if (err > max_block)
+	  max_block = err;
+      }
+
+  printf ("atan: largest error %.2f (table %.2f), magnitude %.2f, "
+	  "block and scalar %d apart\n", max_new, max_old, max_mag,
+	  max_block);
+
+  for (i = 0; i < 32767; i++)
+    {
+      diff = intsqrt (i) - (unsigned short) old_sqrttbl[i];
+      if (diff < 0)
+	diff = -diff;
+      if (diff > max_diff)
+	max_diff = diff;
+    }
+  printf ("sqrt: largest difference from the table %d\n", max_diff);
+
+  srand (4711);
+  for (i = 0; i < KERNEL_VECTORS; i++)
+    {
+      y[i] = rand () % 65535 - 32767;
+      x[i] = rand () % 65535 - 32767;
+      if (x[i] == 0)
+	x[i] = 1;
+    }
+
+  flush = malloc (KERNEL_FLUSH);
+  flushing = kernel_time (3, flush, y, x, angle);
+
+  printf ("ns per vector    warm  flushed\n");
+  for (i = 0; i < 3; i++)
+    printf ("%-14s  %5.1f  %5.1f\n", names[i],
+	    kernel_time (i, 0, y, x, angle),
+	    kernel_time (i, flush, y, x, angle) - flushing);
+
+  free (flush);
+}
+
+/* Known answers and speed of the HDLC frame check sequence.  The
+ * engines are checked against the standard check value and the good
+ * residue, and against each other on frames of all lengths and
+ * alignments.  A frame is then sent through the HDLC encoder and
+ * decoder, once as it is and once with a bit error.  The speed is
+ * compared with the bit at a time CRC the decoder used to do.
+ */
+
+#define CRC_BYTES 4096
+#define CRC_ROUNDS 20000
+
+static ifax_uint16 crc_events[1024];
+static int crc_nevents, crc_flipbit;
+static long crc_linebits;
+
+static ifax_uint16
+old_crc_bitwise (ifax_uint16 crc, const ifax_uint8 *data, size_t length)
+{
+  int x, byte;
+
+  while (length-- > 0)
+    {
+      byte = bitreverse[*data++];
+      for (x = 7; x >= 0; x--)
+	{
+	  if (!(crc & 0x8000) != !(byte & (1 << x)))
+	    crc = (crc << 1) ^ 0x1021;
+	  else
+	    crc <<= 1;
+	}
+    }
+  return crc;
+}
+
+/* Unpack the encoder output to one bit per byte for the decoder,
+ * flipping bit number 'crc_flipbit' on the way.
+ */
+
+static int crc_unpack_handle (ifax_modp self, void *data, size_t length)
+{
+  ifax_uint8 *src = data;
+  char bit;
+  size_t t;
+
+  for (t = 0; t < length; t++)
+    {
+      bit = (src[t >> 3] >> (t & 7)) & 1;
+      if (crc_linebits++ == crc_flipbit)
+	bit ^= 1;
+      ifax_handle_input (self->sendto, &bit, 1);
+    }
+  return length;
+}
+
+static int crc_collect_handle (ifax_modp self, void *data, size_t length)
+{
+  ifax_uint16 *events = data;
+
+  while (length-- > 0 && crc_nevents < 1024)
+    crc_events[crc_nevents++] = *events++;
+  return 0;
+}
+
+static int crc_unpack_construct (ifax_modp self, va_list args)
+{
+  self->handle_input = crc_unpack_handle;
+  self->command = curve_command;
+  self->destroy = curve_destroy;
+  return 0;
+}
+
+static int crc_collect_construct (ifax_modp self, va_list args)
+{
+  self->handle_input = crc_collect_handle;
+  self->command = curve_command;
+  self->destroy = curve_destroy;
+  return 0;
+}
+
+/* Send a DIS-like frame through encoder and decoder.  Returns 1 if
+ * the decoder passed the frame on with a good CRC, 0 if it found a CRC
+ * error, and -1 if it got something else.
+ */
+
+static int
+crc_loopback (int flipbit)
+{
+  static ifax_uint8 payload[] = { 0x13, 0x80, 0x00, 0xce, 0xf4, 0x7e, 0x3f };
+  ifax_module_id unpack_id, collect_id;
+  ifax_modp encoder, unpack, decoder, collect;
+  int e, n, same = 0, result = -1;
+
+  unpack_id = ifax_register_module_class ("Bit unpacker", crc_unpack_construct);
+  collect_id = ifax_register_module_class ("Event collector",
+					   crc_collect_construct);
+  encoder = ifax_create_module (IFAX_ENCODER_HDLC);
+  unpack = ifax_create_module (unpack_id);
+  decoder = ifax_create_module (IFAX_DECODE_HDLC);
+  collect = ifax_create_module (collect_id);
+  ifax_connect (encoder, unpack);
+  ifax_connect (unpack, decoder);
+  ifax_connect (decoder, collect);
+
+  crc_nevents = 0;
+  crc_linebits = 0;
+  crc_flipbit = flipbit;
+  ifax_command (encoder, CMD_HDLC_FRAMING_TXFRAME, payload,
+		(int) sizeof (payload), 0xff);
+  ifax_handle_demand (encoder, 256);
+
+  /* The frame is what came between the last two flags */
+  n = 0;
+  for (e = 0; e < crc_nevents; e++)
+    {
+      if (crc_events[e] == HDLC_FLAG)
+	n = same = 0;
+      else if (crc_events[e] == HDLC_CRC_OK || crc_events[e] == HDLC_CRC_ERR)
+	{
+	  if (n == sizeof (payload) + 3)
+	    result = crc_events[e] == HDLC_CRC_ERR ? 0 : same == n - 2 ? 1 : -1;
+	}
+      else if (n++ == 0)
+	same += crc_events[e] == bitreverse[0xff];
+      else if (n <= sizeof (payload) + 1)
+	same += crc_events[e] == bitreverse[payload[n - 2]];
+    }
+
+  ifax_destroy_module (encoder);
+  ifax_destroy_module (unpack);
+  ifax_destroy_module (decoder);
+  ifax_destroy_module (collect);
+
+  return result;
+}
+
+static double
+crc_time (int how, const ifax_uint8 *data, size_t length)
+{
+  struct timeval start, end;
+  double best = 1e30, ns;
+  int tries, r, rounds = CRC_ROUNDS * 64 / (length + 64);
+  volatile ifax_uint16 crc = 0;
+
+  for (tries = 0; tries < 5; tries++)
+    {
+      gettimeofday (&start, 0);
+      for (r = 0; r < rounds; r++)
+	switch (how)
+	  {
+	  case 0:
+	    crc ^= old_crc_bitwise (0xffff, data, length);
+	    break;
+	  case 1:
+	    crc ^= ifax_crc16_bytewise (0xffff, data, length);
+	    break;
+	  case 2:
+	    crc ^= ifax_crc16_slice8 (0xffff, data, length);
+	    break;
+	  case 3:
+	    crc ^= ifax_crc16_clmul (0xffff, data, length);
+	    break;
+	  }
+      gettimeofday (&end, 0);
+
+      ns = ((end.tv_sec - start.tv_sec) * 1e6
+	    + (end.tv_usec - start.tv_usec)) * 1000.0;
+      if (ns < best)
+	best = ns;
+    }
+
+  return best / rounds / length;
+}
+
+void
+test_crc16 (void)
+{
+  static char *names[4] = { "bit at a time", "byte at a time",
+			    "slicing-by-8", "carry-less mult" };
+  static size_t sizes[4] = { 16, 64, 256, 4096 };
+  static ifax_uint8 data[CRC_BYTES + 16];
+  ifax_uint8 *check = (ifax_uint8 *) "123456789";
+  ifax_uint16 crc, fcs, init;
+  size_t length, offset;
+  int failed = 0, i;
+
+  /* Check value of CRC-16/X.25, and the good residue after the FCS
+     (bit-reversed for the old CRC) */
+  fcs = ifax_crc16 (check, 9);
+  memcpy (data, check, 9);
+  data[9] = fcs & 0xff;
+  data[10] = fcs >> 8;
+  if (fcs != 0x906e || !ifax_crc16_check (data, 11)
+      || ifax_crc16_bytewise (0xffff, check, 9) != 0x6f91
+      || ifax_crc16_slice8 (0xffff, check, 9) != 0x6f91
+      || ifax_crc16_clmul (0xffff, check, 9) != 0x6f91
+      || old_crc_bitwise (0xffff, data, 11) != 0x1d0f)
+    {
+      printf ("crc16: check value wrong (FCS %04x)\n", fcs);
+      failed++;
+    }
+
+  srand (4711);
+  for (i = 0; i < CRC_BYTES + 16; i++)
+    data[i] = rand ();
+
+  for (length = 0; length <= 1100; length++)
+    for (offset = 0; offset < 8; offset++)
+      {
+	init = rand ();
+	crc = ifax_crc16_bytewise (init, data + offset, length);
+	if (ifax_crc16_slice8 (init, data + offset, length) != crc
+	    || ifax_crc16_clmul (init, data + offset, length) != crc)
+	  {
+	    if (failed++ < 10)
+	      printf ("crc16: engines differ, length %d offset %d\n",
+		      (int) length, (int) offset);
+	  }
+      }
+
+  if (crc_loopback (-1) != 1)
+    {
+      printf ("crc16: intact frame not received\n");
+      failed++;
+    }
+  if (crc_loopback (60) != 0)
+    {
+      printf ("crc16: bit error not detected\n");
+      failed++;
+    }
+
+  printf ("crc16: %s, %s\n", ifax_crc16_engine (),
+	  failed ? "FAILED" : "all tests passed");
+
+  printf ("ns per byte      %6d %6d %6d %6d\n",
+	  (int) sizes[0], (int) sizes[1], (int) sizes[2], (int) sizes[3]);
+  for (i = 0; i < 4; i++)
+    printf ("%-15s  %6.2f %6.2f %6.2f %6.2f\n", names[i],
+	    crc_time (i, data, sizes[0]), crc_time (i, data, sizes[1]),
+	    crc_time (i, data, sizes[2]), crc_time (i, data, sizes[3]));
+}
+
+/* The packed mode of the HDLC decoder, against a line made by the HDLC
+ * encoder.  Random frames, with many 0xff and 0x7e bytes for bit
+ * stuffing, are sent through the encoder and stored one bit per byte.
+ * The line is then fed to the decoder packed, in chunks of odd sizes,
+ * and the frames that come out are compared with the ones sent.  This
+ * is done with the line as it is, with an abort (8 ones) in the middle
+ * of the longest frame, and with a bit error there.  The speed is
+ * compared with the decoder taking one bit per byte.
+ */
+
+#define DEFRAME_FRAMES 100
+#define DEFRAME_MAXFRAME 260
+#define DEFRAME_LINE (DEFRAME_FRAMES * (DEFRAME_MAXFRAME + 4) * 10 + 4096)
+
+static char deframe_line[DEFRAME_LINE], deframe_copy[DEFRAME_LINE];
+static long deframe_length;
+static ifax_uint8 deframe_frames[DEFRAME_FRAMES][DEFRAME_MAXFRAME];
+static int deframe_sizes[DEFRAME_FRAMES];
+
+static int deframe_capture_handle (ifax_modp self, void *data, size_t length)
+{
+  ifax_uint8 *src = data;
+  size_t t;
+
+  for (t = 0; t < length && deframe_length < DEFRAME_LINE; t++)
+    deframe_line[deframe_length++] = (src[t >> 3] >> (t & 7)) & 1;
+  return length;
+}
+
+static int deframe_capture_construct (ifax_modp self, va_list args)
+{
+  self->handle_input = deframe_capture_handle;
+  self->command = curve_command;
+  self->destroy = curve_destroy;
+  return 0;
+}
+
+/* Run 'line' through a packed decoder in chunks of 1 to 2000 bits, and
+ * count the frames that come out good and as they were sent, good but
+ * different (should never happen), bad and aborted.
+ */
+
+static void
+deframe_run (char *line, int *good, int *wrong, int *bad, int *aborted)
+{
+  static ifax_uint8 packed[256], frame[DEFRAME_MAXFRAME];
+  ifax_modp decoder;
+  long pos = 0, chunk, t;
+  int expect = 0, length, status, f;
+
+  decoder = ifax_create_module (IFAX_DECODE_HDLC);
+  ifax_command (decoder, CMD_DECODE_HDLC_PACKED, 1);
+  *good = *wrong = *bad = *aborted = 0;
+
+  while (pos < deframe_length)
+    {
+      chunk = rand () % 2000 + 1;
+      if (chunk > deframe_length - pos)
+	chunk = deframe_length - pos;
+      memset (packed, 0, sizeof (packed));
+      for (t = 0; t < chunk; t++)
+	packed[t >> 3] |= line[pos + t] << (t & 7);
+      ifax_handle_input (decoder, packed, chunk);
+      pos += chunk;
+
+      while ((length = ifax_command (decoder, CMD_DECODE_HDLC_GETFRAME,
+				     frame, DEFRAME_MAXFRAME, &status)) >= 0)
+	{
+	  if (status == HDLC_ABORT)
+	    (*aborted)++;
+	  else if (status != HDLC_CRC_OK)
+	    (*bad)++;
+	  else
+	    {
+	      /* A lost frame is skipped, not counted as wrong */
+	      for (f = expect; f < DEFRAME_FRAMES; f++)
+		if (length == deframe_sizes[f]
+		    && memcmp (frame, deframe_frames[f], length) == 0)
+		  break;
+	      if (f < DEFRAME_FRAMES)
+		{
+		  (*good)++;
+		  expect = f + 1;
+		}
+	      else
+		(*wrong)++;
+	    }
+	}
+    }
+
+  ifax_destroy_module (decoder);
+}
+
+static double
+deframe_time (int packed)
+{
+  static ifax_uint8 bytes[DEFRAME_LINE / 8 + 1];
+  struct timeval start, end;
+  ifax_modp decoder;
+  double best = 1e30, ns;
+  int tries, status;
+  long t;
+
+  memset (bytes, 0, sizeof (bytes));
+  for (t = 0; t < deframe_length; t++)
+    bytes[t >> 3] |= deframe_line[t] << (t & 7);
+
+  for (tries = 0; tries < 5; tries++)
+    {
+      decoder = ifax_create_module (IFAX_DECODE_HDLC);
+      ifax_command (decoder, CMD_DECODE_HDLC_PACKED, packed);
+      gettimeofday (&start, 0);
+      if (packed)
+	{
+	  for (t = 0; t + 2048 <= deframe_length; t += 2048)
+	    {
+	      ifax_handle_input (decoder, &bytes[t >> 3], 2048);
+	      while (ifax_command (decoder, CMD_DECODE_HDLC_GETFRAME,
+				   deframe_copy, DEFRAME_MAXFRAME, &status) >= 0)
+		;
+	    }
+	}
+      else
+	{
+	  for (t = 0; t + 2048 <= deframe_length; t += 2048)
+	    ifax_handle_input (decoder, &deframe_line[t], 2048);
+	}
+      gettimeofday (&end, 0);
+      ifax_destroy_module (decoder);
+
+      ns = ((end.tv_sec - start.tv_sec) * 1e6
+	    + (end.tv_usec - start.tv_usec)) * 1000.0;
+      if (ns < best)
+	best = ns;
+    }
+
+  return best / (deframe_length - deframe_length % 2048);
+}
+
+void
+test_hdlc_deframer (void)
+{
+  ifax_module_id capture_id;
+  ifax_modp encoder, capture;
+  int good, wrong, bad, aborted, failed = 0, f, i, run;
+  long t, flag, gap = 0, middle = 0;
+
+  srand (4711);
+  for (f = 0; f < DEFRAME_FRAMES; f++)
+    {
+      deframe_sizes[f] = rand () % (DEFRAME_MAXFRAME - 2) + 3;
+      for (i = 0; i < deframe_sizes[f]; i++)
+	switch (rand () % 4)
+	  {
+	  case 0:
+	    deframe_frames[f][i] = 0xff;
+	    break;
+	  case 1:
+	    deframe_frames[f][i] = 0x7e;
+	    break;
+	  default:
+	    deframe_frames[f][i] = rand ();
+	  }
+    }
+
+  capture_id = ifax_register_module_class ("Line capture",
+					   deframe_capture_construct);
+  encoder = ifax_create_module (IFAX_ENCODER_HDLC);
+  capture = ifax_create_module (capture_id);
+  ifax_connect (encoder, capture);
+
+  deframe_length = 0;
+  for (f = 0; f < DEFRAME_FRAMES; f++)
+    ifax_command (encoder, CMD_HDLC_FRAMING_TXFRAME, &deframe_frames[f][1],
+		  deframe_sizes[f] - 1, deframe_frames[f][0]);
+  while (deframe_length < DEFRAME_LINE - 1024
+	 && ifax_command (encoder, CMD_HDLC_FRAMING_IDLE) < 32)
+    ifax_handle_demand (encoder, 1000);
+
+  ifax_destroy_module (encoder);
+  ifax_destroy_module (capture);
+
+  deframe_run (deframe_line, &good, &wrong, &bad, &aborted);
+  printf ("deframer: %d good, %d wrong, %d bad, %d aborted\n",
+	  good, wrong, bad, aborted);
+  if (good != DEFRAME_FRAMES || wrong + bad + aborted != 0)
+    failed++;
+
+  /* The middle of the longest run between flags */
+  run = 0;
+  flag = 0;
+  for (t = 0; t < deframe_length; t++)
+    {
+      run = deframe_line[t] ? run + 1 : 0;
+      if (t >= 7 && run == 0 && deframe_line[t - 7] == 0
+	  && memchr (&deframe_line[t - 6], 0, 6) == 0)
+	{
+	  if (t - flag > gap)
+	    {
+	      gap = t - flag;
+	      middle = (t + flag) / 2;
+	    }
+	  flag = t;
+	}
+    }
+
+  memcpy (deframe_copy, deframe_line, deframe_length);
+  memset (&deframe_copy[middle], 1, 8);
+  deframe_run (deframe_copy, &good, &wrong, &bad, &aborted);
+  printf ("with an abort: %d good, %d wrong, %d bad, %d aborted\n",
+	  good, wrong, bad, aborted);
+  if (good != DEFRAME_FRAMES - 1 || wrong != 0 || aborted != 1)
+    failed++;
+
+  /* A one turned into a zero can't make a flag or an abort */
+  memcpy (deframe_copy, deframe_line, deframe_length);
+  while (deframe_copy[middle] == 0)
+    middle++;
+  deframe_copy[middle] = 0;
+  deframe_run (deframe_copy, &good, &wrong, &bad, &aborted);
+  printf ("with a bit error: %d good, %d wrong, %d bad, %d aborted\n",
+	  good, wrong, bad, aborted);
+  if (good != DEFRAME_FRAMES - 1 || wrong != 0 || bad != 1)
+    failed++;
+
+  printf ("deframer: %s\n", failed ? "FAILED" : "all tests passed");
+  printf ("ns per bit: one bit per byte %.2f, packed %.2f\n",
+	  deframe_time (0), deframe_time (1));
+}
+
+/* The HDLC encoder against a plain bit at a time encoder, on random
+ * frames with many 0xff, 0x7e and 0x1f bytes for bit stuffing, taken
+ * out in demands of random size.  The speed is measured on frames of
+ * 256 bytes, like ECM frames, with demands of 4096 bits.
+ */
+
+static long
+reference_byte (char *line, long pos, int byte, int stuff, int *ones)
+{
+  int b;
+
+  for (b = 0; b < 8; b++)
+    {
+      line[pos++] = (byte >> b) & 1;
+      if (stuff && line[pos - 1] && ++*ones == 5)
+	{
+	  line[pos++] = 0;
+	  *ones = 0;
+	}
+      else if (!line[pos - 1])
+	*ones = 0;
+    }
+  return pos;
+}
+
+static long
+reference_encode (char *line, long length)
+{
+  long pos = 0;
+  int f, i, ones = 0;
+  ifax_uint16 fcs;
+
+  pos = reference_byte (line, pos, 0x7e, 0, &ones);
+  pos = reference_byte (line, pos, 0x7e, 0, &ones);
+  for (f = 0; f < DEFRAME_FRAMES; f++)
+    {
+      pos = reference_byte (line, pos, 0x7e, 0, &ones);
+      ones = 0;
+      fcs = ifax_crc16 (deframe_frames[f], deframe_sizes[f]);
+      for (i = 0; i < deframe_sizes[f]; i++)
+	pos = reference_byte (line, pos, deframe_frames[f][i], 1, &ones);
+      pos = reference_byte (line, pos, fcs & 0xff, 1, &ones);
+      pos = reference_byte (line, pos, fcs >> 8, 1, &ones);
+    }
+  while (pos + 8 <= length)
+    pos = reference_byte (line, pos, 0x7e, 0, &ones);
+
+  return pos;
+}
+
+static double
+encoder_time (ifax_module_id capture_id)
+{
+  static ifax_uint8 frame[256];
+  struct timeval start, end;
+  ifax_modp encoder, capture;
+  double best = 1e30, ns;
+  long bits;
+  int tries, f;
+
+  for (f = 0; f < 256; f++)
+    frame[f] = rand ();
+
+  for (tries = 0; tries < 5; tries++)
+    {
+      encoder = ifax_create_module (IFAX_ENCODER_HDLC);
+      capture = ifax_create_module (capture_id);
+      ifax_connect (encoder, capture);
+      deframe_length = DEFRAME_LINE;	/* Capture nothing */
+
+      gettimeofday (&start, 0);
+      for (f = 0; f < 100; f++)
+	ifax_command (encoder, CMD_HDLC_FRAMING_TXFRAME, frame, 256, 0xff);
+      for (bits = 0; ifax_command (encoder, CMD_HDLC_FRAMING_IDLE) == 0;
+	   bits += 4096)
+	ifax_handle_demand (encoder, 4096);
+      gettimeofday (&end, 0);
+
+      ifax_destroy_module (encoder);
+      ifax_destroy_module (capture);
+
+      ns = ((end.tv_sec - start.tv_sec) * 1e6
+	    + (end.tv_usec - start.tv_usec)) * 1000.0;
+      if (ns < best)
+	best = ns;
+    }
+
+  return best / bits;
+}
+
+void
+test_hdlc_encoder (void)
+{
+  ifax_module_id capture_id;
+  ifax_modp encoder, capture;
+  struct timeval start, end;
+  long length, t;
+  int f, i, rounds;
+
+  srand (4712);
+  for (f = 0; f < DEFRAME_FRAMES; f++)
+    {
+      deframe_sizes[f] = rand () % (DEFRAME_MAXFRAME - 2) + 3;
+      for (i = 0; i < deframe_sizes[f]; i++)
+	switch (rand () % 5)
+	  {
+	  case 0:
+	    deframe_frames[f][i] = 0xff;
+	    break;
+	  case 1:
+	    deframe_frames[f][i] = 0x7e;
+	    break;
+	  case 2:
+	    deframe_frames[f][i] = 0x1f;
+	    break;
+	  default:
+	    deframe_frames[f][i] = rand ();
+	  }
+    }
+
+  capture_id = ifax_register_module_class ("Line capture",
+					   deframe_capture_construct);
+  encoder = ifax_create_module (IFAX_ENCODER_HDLC);
+  capture = ifax_create_module (capture_id);
+  ifax_connect (encoder, capture);
+
+  deframe_length = 0;
+  for (f = 0; f < DEFRAME_FRAMES; f++)
+    ifax_command (encoder, CMD_HDLC_FRAMING_TXFRAME, &deframe_frames[f][1],
+		  deframe_sizes[f] - 1, deframe_frames[f][0]);
+  while (deframe_length < DEFRAME_LINE - 8192
+	 && ifax_command (encoder, CMD_HDLC_FRAMING_IDLE) < 64)
+    ifax_handle_demand (encoder, rand () % 3000 + 1);
+
+  ifax_destroy_module (encoder);
+  ifax_destroy_module (capture);
+
+  length = reference_encode (deframe_copy, deframe_length);
+  for (t = 0; t < length && deframe_line[t] == deframe_copy[t]; t++)
+    ;
+  printf ("encoder: %ld bits, %s\n", deframe_length,
+	  t == length ? "same as the reference" : "FAILED");
+  if (t < length)
+    printf ("first difference at bit %ld of %ld\n", t, length);
+
+  gettimeofday (&start, 0);
+  for (rounds = 0; rounds < 20; rounds++)
+    reference_encode (deframe_copy, 0);
+  gettimeofday (&end, 0);
+
+  printf ("ns per bit: bit at a time %.2f, encoder %.2f\n",
+	  ((end.tv_sec - start.tv_sec) * 1e6
+	   + (end.tv_usec - start.tv_usec)) * 1000.0 / rounds / length,
+	  encoder_time (capture_id));
+}
+
+/* Feed the encoder through a few reusable buffers, taking a buffer
+ * again as soon as the encoder says it is done with it.  If that is
+ * said too early, the output will differ from the reference.
+ */
+
+#define QUEUE_SLOTS 8
+
+static int queue_done[DEFRAME_FRAMES], queue_next_done;
+
+static void
+queue_frame_done (void *arg, ifax_uint8 *start)
+{
+  int *slot = arg;
+
+  queue_done[slot[1]] = queue_next_done++;
+  slot[0] = 0;
+}
+
+void
+test_hdlc_queue (void)
+{
+  static ifax_uint8 buffer[QUEUE_SLOTS][DEFRAME_MAXFRAME];
+  static int slot[QUEUE_SLOTS][2];	/* Busy, frame number */
+  ifax_module_id capture_id;
+  ifax_modp encoder, capture;
+  long length, t;
+  int f, i, s, refused, inorder;
+
+  srand (4713);
+  for (f = 0; f < DEFRAME_FRAMES; f++)
+    {
+      deframe_sizes[f] = rand () % (DEFRAME_MAXFRAME - 2) + 3;
+      for (i = 0; i < deframe_sizes[f]; i++)
+	deframe_frames[f][i] = rand ();
+      queue_done[f] = -1;
+    }
+  queue_next_done = 0;
+
+  capture_id = ifax_register_module_class ("Line capture",
+					   deframe_capture_construct);
+  encoder = ifax_create_module (IFAX_ENCODER_HDLC);
+  capture = ifax_create_module (capture_id);
+  ifax_connect (encoder, capture);
+  ifax_command (encoder, CMD_HDLC_FRAMING_DEPTH, QUEUE_SLOTS - 1);
+
+  deframe_length = 0;
+  refused = 0;
+  f = 0;
+  while (deframe_length < DEFRAME_LINE - 8192
+	 && ifax_command (encoder, CMD_HDLC_FRAMING_IDLE) < 64)
+    {
+      for (s = 0; s < QUEUE_SLOTS && f < DEFRAME_FRAMES; s++)
+	{
+	  if (slot[s][0])
+	    continue;
+	  memcpy (buffer[s], deframe_frames[f], deframe_sizes[f]);
+	  slot[s][0] = 1;
+	  slot[s][1] = f;
+	  if (ifax_command (encoder, CMD_HDLC_FRAMING_SUBMIT, &buffer[s][1],
+			    deframe_sizes[f] - 1, buffer[s][0],
+			    queue_frame_done, slot[s]))
+	    {
+	      /* The queue is full, try again later */
+	      slot[s][0] = 0;
+	      refused++;
+	      break;
+	    }
+	  f++;
+	}
+      ifax_handle_demand (encoder, rand () % 3000 + 1);
+    }
+
+  i = ifax_command (encoder, CMD_HDLC_FRAMING_COMPLETE);
+  ifax_destroy_module (encoder);
+  ifax_destroy_module (capture);
+
+  for (inorder = 1, f = 0; f < DEFRAME_FRAMES; f++)
+    if (queue_done[f] != f)
+      inorder = 0;
+
+  length = reference_encode (deframe_copy, deframe_length);
+  for (t = 0; t < length && deframe_line[t] == deframe_copy[t]; t++)
+    ;
+  printf ("queue: %ld bits, %s, %d refused, %s, %d left\n", deframe_length,
+	  t == length ? "same as the reference" : "FAILED",
+	  refused, inorder ? "done in order" : "NOT DONE IN ORDER", i);
+  if (t < length)
+    printf ("first difference at bit %ld of %ld\n", t, length);
+}
+
+/* The byte at a time V.29 scrambler and descrambler, as they were
+ * before going 64 bits at a time, to compare against.
+ */
+
+#define SCRAM_BYTES 4096
+
+static void
+old_scramble_V29 (ifax_uint8 *src, ifax_uint8 *dst, ifax_uint32 *state,
+		  size_t size)
+{
+  ifax_uint8 next;
+  ifax_uint32 st = *state;
+  int b;
+
+  for (; size >= 8; size -= 8)
+    {
+      next = (st ^ (st >> 5) ^ (*src++)) & 0xff;
+      *dst++ = next;
+      st = (next << 15) | (st >> 8);
+    }
+  if (size)
+    {
+      *dst = 0;
+      for (b = 0; b < size; b++)
+	{
+	  next = (st ^ (st >> 5) ^ (*src >> b)) & 1;
+	  st = (next << 22) | (st >> 1);
+	  *dst |= next << b;
+	}
+    }
+  *state = st;
+}
+
+static void
+old_descramble_V29 (ifax_uint8 *src, ifax_uint8 *dst, ifax_uint32 *state,
+		    size_t size)
+{
+  ifax_uint8 input;
+  ifax_uint32 st = *state;
+  int b;
+
+  for (; size >= 8; size -= 8)
+    {
+      input = *src++;
+      *dst++ = input ^ ((st ^ (st >> 5)) & 0xff);
+      st = (input << 15) | (st >> 8);
+    }
+  if (size)
+    {
+      *dst = 0;
+      for (b = 0; b < size; b++)
+	{
+	  input = (*src >> b) & 1;
+	  *dst |= (input ^ ((st ^ (st >> 5)) & 1)) << b;
+	  st = (input << 22) | (st >> 1);
+	}
+    }
+  *state = st;
+}
+
+static double
+scram_time (int how, ifax_uint8 *data, size_t bits)
+{
+  static ifax_uint8 out[SCRAM_BYTES];
+  struct timeval start, end;
+  double best = 1e30, ns;
+  ifax_uint32 state = 0;
+  int tries, r, rounds = 20000;
+
+  for (tries = 0; tries < 5; tries++)
+    {
+      gettimeofday (&start, 0);
+      for (r = 0; r < rounds; r++)
+	switch (how)
+	  {
+	  case 0:
+	    old_scramble_V29 (data, out, &state, bits);
+	    break;
+	  case 1:
+	    scramble_V29 (data, out, &state, bits);
+	    break;
+	  case 2:
+	    old_descramble_V29 (data, out, &state, bits);
+	    break;
+	  case 3:
+	    descramble_V29 (data, out, &state, bits);
+	    break;
+	  }
+      gettimeofday (&end, 0);
+
+      ns = ((end.tv_sec - start.tv_sec) * 1e6
+	    + (end.tv_usec - start.tv_usec)) * 1000.0;
+      if (ns < best)
+	best = ns;
+    }
+
+  return best / rounds / bits;
+}
+
+/* Run random data through both versions in pieces of random length,
+ * which keeps the state passing from one call to the next, and check
+ * the descrambler undoes the scrambler in place.
+ */
+
+void
+test_scrambler_words (void)
+{
+  static ifax_uint8 data[SCRAM_BYTES], a[SCRAM_BYTES], b[SCRAM_BYTES];
+  ifax_uint32 old_state, new_state, old_dstate, new_dstate;
+  int trial, bytes, bad = 0, baddescr = 0, badback = 0;
+  size_t bits;
+
+  srand (4714);
+  for (bytes = 0; bytes < SCRAM_BYTES; bytes++)
+    data[bytes] = rand ();
+
+  old_state = new_state = old_dstate = new_dstate = 0;
+  for (trial = 0; trial < 10000; trial++)
+    {
+      bits = rand () % (8 * 300);
+      if (rand () % 4 == 0)
+	bits &= ~7;
+      bytes = (bits + 7) / 8;
+
+      old_scramble_V29 (data, a, &old_state, bits);
+      scramble_V29 (data, b, &new_state, bits);
+      if (memcmp (a, b, bytes) != 0 || old_state != new_state)
+	bad++;
+
+      old_descramble_V29 (data, a, &old_dstate, bits);
+      descramble_V29 (data, b, &new_dstate, bits);
+      if (memcmp (a, b, bytes) != 0 || old_dstate != new_dstate)
+	baddescr++;
+    }
+
+  /* A whole HDLC payload at a time, in place */
+  old_state = new_state = 0;
+  for (trial = 0; trial < 100; trial++)
+    {
+      bytes = rand () % 257;
+      memcpy (a, data + trial, bytes);
+      scramble_V29 (a, a, &old_state, bytes * 8);
+      descramble_V29 (a, a, &new_state, bytes * 8);
+      if (memcmp (a, data + trial, bytes) != 0)
+	badback++;
+    }
+
+  printf ("scrambler: %d, descrambler: %d differ from the byte code, "
+	  "%d not undone\n", bad, baddescr, badback);
+  printf ("ns per bit, 256 byte payload:\n"
+	  "  scramble byte %.3f, word %.3f\n"
+	  "  descramble byte %.3f, word %.3f\n",
+	  scram_time (0, data, 2048), scram_time (1, data, 2048),
+	  scram_time (2, data, 2048), scram_time (3, data, 2048));
+}
+
+/* Two lines joined by the loopback driver, each with a linedriver and a
+ * fax context like in amodemd.  One end sends a frame after a second of
+ * flags, and the other end demodulates and decodes it.  Both ends start
+ * out with silence, and the receiving end stays with it.
+ */
+
+void
+test_loopback_frame (void)
+{
+  static ifax_uint8 payload[] = { 0x13, 0x80, 0x00, 0xce, 0xf4, 0x7e, 0x3f };
+  struct HardwareHandle *hh[2];
+  ifax_modp line[2], demod, sync, decoder, collect;
+  ifax_module_id collect_id;
+  struct G3fax *fax_tx;
+  long samples;
+  int e, n, same = 0, result = -1, side, sent = 0;
+
+  for (side = 0; side < 2; side++)
+    {
+      hh[side] = hardware_allocate ("loopback");
+      hh[side]->configure (hh[side], "pair", "test");
+      hh[side]->initialize (hh[side]);
+      line[side] = ifax_create_module (IFAX_LINEDRIVER);
+      ifax_command (line[side], CMD_LINEDRIVER_HARDWARE, hh[side]);
+    }
+
+  initialize_G3fax (line[1]);
+  fax_tx = initialize_G3fax (line[0]);
+  ifax_connect (fax_tx->encoderHDLC, fax_tx->txV21);
+  ifax_connect (fax_tx->txV21, line[0]);
+
+  collect_id = ifax_register_module_class ("Event collector",
+					   crc_collect_construct);
+  demod = ifax_create_module (IFAX_FSKDEMOD, 8000, 1650, 1850, 300);
+  sync = ifax_create_module (IFAX_SYNCBIT, 8000, 300);
+  decoder = ifax_create_module (IFAX_DECODE_HDLC);
+  collect = ifax_create_module (collect_id);
+  ifax_connect (line[1], demod);
+  ifax_connect (demod, sync);
+  ifax_connect (sync, decoder);
+  ifax_connect (decoder, collect);
+
+  crc_nevents = 0;
+  for (samples = 0; samples < 3 * 8000;)
+    {
+      if (samples >= 8000 && !sent)
+	{
+	  ifax_command (fax_tx->encoderHDLC, CMD_HDLC_FRAMING_TXFRAME,
+			payload, (int) sizeof (payload), 0xff);
+	  sent = 1;
+	}
+      samples += ifax_command (line[0], CMD_LINEDRIVER_WORK);
+      ifax_command (line[1], CMD_LINEDRIVER_WORK);
+    }
+
+  /* The frame is what came between the last two flags */
+  n = 0;
+  for (e = 0; e < crc_nevents; e++)
+    {
+      if (crc_events[e] == HDLC_FLAG)
+	n = same = 0;
+      else if (crc_events[e] == HDLC_CRC_OK || crc_events[e] == HDLC_CRC_ERR)
+	{
+	  if (n == sizeof (payload) + 3 && crc_events[e] == HDLC_CRC_OK)
+	    result = same == n - 2;
+	}
+      else if (n++ == 0)
+	same += crc_events[e] == bitreverse[0xff];
+      else if (n <= sizeof (payload) + 1)
+	same += crc_events[e] == bitreverse[payload[n - 2]];
+    }
+
+  printf ("loopback: %ld samples, frame %s\n", samples,
+	  result == 1 ? "received" : result == 0 ? "CORRUPTED" : "LOST");
+}
+
+
+/* Send two HDLC frames with +FTH, the way a fax application would over
+ * the pty, and check that OK comes back when they have been sent and
+ * the line is back to silence.  The line is one end of a loopback pair,
+ * and the other end demodulates and decodes what it receives: a second
+ * of flags, and then both frames whole with a good CRC.
+ */
+
+static ifax_modp fth_line;
+
+/* 'do_dial' in highlevel/commandparse.c calls these, which are not
+ * written yet.  Nothing here dials, so they only need to link.
+ */
+
+int
+last_command (struct ModemHandle *mh, struct PtyHandle *ph)
+{
+  return 1;
+}
+
+int
+setup_call (struct ModemHandle *mh)
+{
+  return 0;
+}
+
+static int
+fth_tx_hdlc (void *arg, int on)
+{
+  struct G3fax *f = arg;
+
+  if (on)
+    {
+      ifax_connect (f->encoderHDLC, f->txV21);
+      ifax_connect (f->txV21, fth_line);
+    }
+  else
+    {
+      ifax_connect (f->silence, f->txsamples);
+      ifax_connect (f->txsamples, fth_line);
+    }
+  return 0;
+}
+
+void
+test_fth_ok (void)
+{
+  static char input[] =
+    "AT+FTH=3\r"
+    "\xff\x03\x80\x10\x10\x42\x10\x03"	/* DLE doubled in the data */
+    "\xff\x13\x80\x00\xce\xf4\x10\x03";	/* P/F bit: final frame */
+  static ifax_uint8 frames[2][7] = {
+    { 0xff, 0x03, 0x80, 0x10, 0x42 },
+    { 0xff, 0x13, 0x80, 0x00, 0xce, 0xf4 }
+  };
+  static int lengths[2] = { 5, 6 };
+  struct HardwareHandle *hh[2];
+  struct PtyHandle *ph;
+  struct ModemHandle *mh;
+  struct G3fax *fax_tx;
+  struct termios tio;
+  ifax_modp line[2], demod, sync, decoder, collect;
+  char reply[1024], *p;
+  long samples, ok_at = -1;
+  int master, side, n, e, got = 0, connects = 0;
+  int flags = 0, frame = 0, good = 0, bytes = 0, same = 0;
+
+  for (side = 0; side < 2; side++)
+    {
+      hh[side] = hardware_allocate ("loopback");
+      hh[side]->configure (hh[side], "pair", "fth");
+      hh[side]->initialize (hh[side]);
+      line[side] = ifax_create_module (IFAX_LINEDRIVER);
+      ifax_command (line[side], CMD_LINEDRIVER_HARDWARE, hh[side]);
+    }
+
+  initialize_G3fax (line[1]);
+  fax_tx = initialize_G3fax (line[0]);
+  fth_line = line[0];
+
+  demod = ifax_create_module (IFAX_FSKDEMOD, 8000, 1650, 1850, 300);
+  sync = ifax_create_module (IFAX_SYNCBIT, 8000, 300);
+  decoder = ifax_create_module (IFAX_DECODE_HDLC);
+  collect = ifax_create_module (ifax_register_module_class
+				("Event collector", crc_collect_construct));
+  ifax_connect (line[1], demod);
+  ifax_connect (demod, sync);
+  ifax_connect (sync, decoder);
+  ifax_connect (decoder, collect);
+  crc_nevents = 0;
+
+  master = posix_openpt (O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt (master) || unlockpt (master))
+    {
+      printf ("fth: no pty\n");
+      return;
+    }
+  fcntl (master, F_SETFL, O_NONBLOCK);
+
+  ph = pty_initialize (ptsname (master));
+  tcgetattr (ph->ptyfd, &tio);
+  cfmakeraw (&tio);
+  tcsetattr (ph->ptyfd, TCSANOW, &tio);
+
+  mh = modem_initialize ();
+  mh->hdlc_tx = fax_tx->encoderHDLC;
+  mh->tx_hdlc = fth_tx_hdlc;
+  mh->tx_arg = fax_tx;
+
+  write (master, input, sizeof (input) - 1);
+
+  /* Go on for a while after OK, for the far end to see the last flag */
+  for (samples = 0; samples < 4 * 8000 && (ok_at < 0 || samples < ok_at + 800);)
+    {
+      pty_service_read (ph);
+      modeminput (mh, ph);
+      pty_service_write (ph);
+
+      if ((n = read (master, reply + got, sizeof (reply) - 1 - got)) > 0)
+	got += n;
+      reply[got] = '\0';
+      if (ok_at < 0 && strstr (reply, "OK") != 0)
+	ok_at = samples;
+
+      samples += ifax_command (line[0], CMD_LINEDRIVER_WORK);
+      ifax_command (line[1], CMD_LINEDRIVER_WORK);
+    }
+
+  for (p = reply; (p = strstr (p, "CONNECT")) != 0; p++)
+    connects++;
+
+  /* Flags before the first frame, then the frames between flags */
+  for (e = 0; e < crc_nevents && frame < 2; e++)
+    {
+      if (crc_events[e] == HDLC_FLAG)
+	{
+	  if (frame == 0 && bytes == 0)
+	    flags++;
+	  bytes = same = 0;
+	}
+      else if (crc_events[e] == HDLC_CRC_OK || crc_events[e] == HDLC_CRC_ERR)
+	{
+	  /* Back to back flags are reported as empty, bad frames */
+	  if (bytes == 0)
+	    continue;
+	  if (crc_events[e] == HDLC_CRC_OK && bytes == lengths[frame] + 2
+	      && same == lengths[frame])
+	    good++;
+	  frame++;
+	}
+      else
+	{
+	  if (bytes < lengths[frame]
+	      && crc_events[e] == bitreverse[frames[frame][bytes]])
+	    same++;
+	  bytes++;
+	}
+    }
+
+  printf ("fth: %d CONNECT, OK %s (%ld samples), line %s, "
+	  "%d flags first, %d of 2 frames received\n", connects,
+	  ok_at < 0 ? "MISSING" : "given", ok_at,
+	  line[0]->recvfrom == fax_tx->txsamples ? "silent" : "NOT SILENT",
+	  flags, good);
+}
+
+
+/* Run the same bits through a V.21 modulator and rate-converter, once
+ * as separate modules and once compiled into a pipeline, and check that
+ * the samples are the same.  A chain where the formats don't match must
+ * not compile, and a compiled pipeline must follow a new source.
+ */
+
+#define PIPE_BYTES 50
+#define PIPE_SAMPLES 16000
+
+struct pipe_capture
+{
+  ifax_sint16 s[PIPE_SAMPLES];
+  size_t n;
+};
+
+static struct pipe_capture pipe_out[3];
+
+static int pipe_sink_handle (ifax_modp self, void *data, size_t length)
+{
+  struct pipe_capture *out = self->private;
+
+  if (length > PIPE_SAMPLES - out->n)
+    length = PIPE_SAMPLES - out->n;
+  memcpy (&out->s[out->n], data, length * sizeof (ifax_sint16));
+  out->n += length;
+
+  return length;
+}
+
+static int pipe_sink_construct (ifax_modp self, va_list args)
+{
+  self->private = va_arg (args, void *);
+  self->handle_input = pipe_sink_handle;
+  self->command = curve_command;
+  self->destroy = curve_destroy;
+  self->input_format = IFAX_FORMAT_S16;
+  return 0;
+}
+
+void
+test_pipeline (void)
+{
+  static int chunks[] = { 1, 5, 2, 13, 7, 3, 11, 8 };
+  ifax_uint8 bits[PIPE_BYTES];
+  ifax_modp mod[2], rc[2], sink[3], pipe, silence, sinus;
+  ifax_module_id sink_id;
+  size_t t, before;
+  int p, pos, c, same, quiet, loud;
+
+  sink_id = ifax_register_module_class ("Pipeline sink", pipe_sink_construct);
+
+  for (t = 0; t < PIPE_BYTES; t++)
+    bits[t] = (t * 0x35 + 0x5c) ^ (t >> 2);
+
+  for (p = 0; p < 2; p++)
+    {
+      pipe_out[p].n = 0;
+      mod[p] = ifax_create_module (IFAX_MODULATORV21, 2);
+      rc[p] = ifax_create_module (IFAX_RATECONVERT, 10, 9, 250,
+				  rate_7k2_8k_1, 0x10000);
+      sink[p] = ifax_create_module (sink_id, &pipe_out[p]);
+      ifax_connect (mod[p], rc[p]);
+      ifax_connect (rc[p], sink[p]);
+    }
+
+  pipe = ifax_pipeline_compile (mod[1], rc[1]);
+  if (pipe == 0)
+    {
+      printf ("pipeline: V.21 chain did not compile\n");
+      return;
+    }
+
+  for (p = 0; p < 2; p++)
+    for (pos = c = 0; pos < PIPE_BYTES; pos += chunks[c++ % 8])
+      {
+	t = chunks[c % 8];
+	if (pos + t > PIPE_BYTES)
+	  t = PIPE_BYTES - pos;
+	ifax_handle_input (p == 0 ? mod[0] : pipe, &bits[pos], 8 * t);
+      }
+
+  same = pipe_out[0].n == pipe_out[1].n
+    && !memcmp (pipe_out[0].s, pipe_out[1].s,
+		pipe_out[0].n * sizeof (ifax_sint16));
+  printf ("pipeline: %d samples plain, %d compiled, %s\n",
+	  (int) pipe_out[0].n, (int) pipe_out[1].n,
+	  same ? "same" : "DIFFERENT");
+
+  /* Samples can't be modulated as bits */
+  ifax_connect (rc[0], mod[0]);
+  ifax_connect (mod[0], 0);
+  printf ("pipeline: format mismatch %s\n",
+	  ifax_pipeline_compile (rc[0], mod[0]) == 0 && rc[0]->sendto == mod[0]
+	  ? "refused" : "COMPILED");
+
+  /* Demand through a compiled rate-converter, then switch the source */
+  silence = ifax_create_module (IFAX_SIGNALGEN, CMD_SIGNALGEN_SINUS,
+				7200, 440, 0);
+  sinus = ifax_create_module (IFAX_SIGNALGEN, CMD_SIGNALGEN_SINUS,
+			      7200, 1100, 0xA000);
+  rc[0] = ifax_create_module (IFAX_RATECONVERT, 10, 9, 250,
+			      rate_7k2_8k_1, 0x10000);
+  pipe_out[2].n = 0;
+  sink[2] = ifax_create_module (sink_id, &pipe_out[2]);
+  ifax_connect (silence, rc[0]);
+  ifax_connect (rc[0], sink[2]);
+  pipe = ifax_pipeline_compile (rc[0], rc[0]);
+
+  ifax_handle_demand (pipe, 800);
+  before = pipe_out[2].n;
+  quiet = before > 0;
+  for (t = 0; t < before; t++)
+    quiet &= pipe_out[2].s[t] == 0;
+
+  ifax_connect (sinus, pipe);
+  ifax_handle_demand (pipe, 800);
+  loud = 0;
+  for (t = before; t < pipe_out[2].n; t++)
+    loud += pipe_out[2].s[t] != 0;
+
+  printf ("pipeline: source switch %s\n",
+	  quiet && loud > (int) (pipe_out[2].n - before) / 2
+	  ? "followed" : "MISSED");
+}
+
+
+/* The buffer pool: a released buffer is reused, a shared buffer is
+ * copied before it is written to, and a module without 'handle_buffer'
+ * gets the data while the buffer goes back to the pool.
+ */
+
+static int buffer_sink_units;
+
+static int buffer_sink_handle (ifax_modp self, void *data, size_t length)
+{
+  buffer_sink_units += length;
+  return length;
+}
+
+static int buffer_sink_construct (ifax_modp self, va_list args)
+{
+  self->handle_input = buffer_sink_handle;
+  self->command = curve_command;
+  self->destroy = curve_destroy;
+  return 0;
+}
+
+void
+test_buffer_pool (void)
+{
+  ifax_buffer *a, *b, *c;
+  ifax_modp sink;
+  int errors = 0;
+
+  a = ifax_buffer_alloc (IFAX_FORMAT_S16, 100);
+  errors += a == 0 || a->refcount != 1 || a->length != 100;
+  ifax_buffer_unref (a);
+  b = ifax_buffer_alloc (IFAX_FORMAT_BITS, 8 * 100);
+  errors += b != a;			/* Reused from the pool */
+
+  ((ifax_uint8 *) b->data)[0] = 0x5a;
+  errors += ifax_buffer_writable (b) != b;	/* Sole owner */
+
+  ifax_buffer_ref (b);
+  c = ifax_buffer_writable (b);		/* Shared, so copied */
+  errors += c == b || b->refcount != 1 || c->refcount != 1;
+  errors += ((ifax_uint8 *) c->data)[0] != 0x5a || c->length != 800;
+  errors += c->format != IFAX_FORMAT_BITS;
+  ifax_buffer_unref (c);
+  ifax_buffer_unref (b);
+
+  errors += ifax_buffer_bytes (IFAX_FORMAT_BITS, 9) != 2;
+  errors += ifax_buffer_bytes (IFAX_FORMAT_S16, 9) != 18;
+  errors += ifax_buffer_alloc (IFAX_FORMAT_S16, IFAX_BUFFER_SAMPLES + 1) != 0;
+
+  sink = ifax_create_module (ifax_register_module_class ("Buffer sink",
+					buffer_sink_construct));
+  a = ifax_buffer_alloc (IFAX_FORMAT_S16, 60);
+  buffer_sink_units = 0;
+  ifax_handle_buffer (sink, a);
+  errors += buffer_sink_units != 60;
+  errors += ifax_buffer_alloc (IFAX_FORMAT_S16, 1) != a;
+  ifax_destroy_module (sink);
+
+  printf ("buffer pool: %d errors\n", errors);
+}
+
+
+/* Read a configuration with three lines: two ISDN devices, where the
+ * second 'isdn-device' starts a new line, and a loopback line started
+ * by 'hardware'.  Each line must get its own pty and hardware.
+ */
+
+void
+test_config_lines (void)
+{
+  static char *config =
+    "worker-threads = 2\n"
+    "isdn-device = /dev/ttyI0\n"
+    "isdn-msn = 1234\n"
+    "pty = /dev/ptyq0\n"
+    "isdn-device = /dev/ttyI1\n"
+    "pty = /dev/ptyq1\n"
+    "hardware = loopback\n"
+    "loopback-pair = test\n"
+    "pty = /dev/ptyq2\n";
+  static hardware_type_t types[] = { ISDN, ISDN, LOOPBACK };
+  static char *ptys[] = { "/dev/ptyq0", "/dev/ptyq1", "/dev/ptyq2" };
+  char name[] = "/tmp/amodemd.confXXXXXX";
+  struct ModemLine *line;
+  int fd, n, errors = 0;
+
+  if ((fd = mkstemp (name)) < 0)
+    {
+      printf ("config: no temporary file\n");
+      return;
+    }
+  write (fd, config, strlen (config));
+  close (fd);
+
+  config_file = name;
+  read_configuration_file ();
+  unlink (name);
+
+  for (n = 0, line = lines; line != 0; line = line->next, n++)
+    {
+      if (n >= 3 || line->number != n || line->hh->type != types[n]
+	  || strcmp (line->pty, ptys[n]))
+	errors++;
+    }
+
+  errors += n != 3 || num_lines != 3 || worker_threads != 2;
+
+  printf ("config: %d lines, %d errors\n", n, errors);
+}
+
+
+/* The event loop: a pipe becoming readable calls its handler once
+ * (edge triggered), a deadline ends a wait that would otherwise last
+ * forever, and a removed source is not heard from again.
+ */
+
+static int event_calls, event_seen;
+
+static void event_count (void *context, int events)
+{
+  event_calls++;
+  event_seen |= events;
+}
+
+static long event_ms_since (struct timeval *start)
+{
+  struct timeval now;
+
+  gettimeofday (&now, 0);
+  return (now.tv_sec - start->tv_sec) * 1000
+    + (now.tv_usec - start->tv_usec) / 1000;
+}
+
+void
+test_eventloop (void)
+{
+  struct EventLoop *el;
+  struct EventSource src;
+  struct timeval start, when;
+  int fds[2], expired, errors = 0;
+  long waited, deadline_ms;
+
+  el = eventloop_create ();
+  pipe (fds);
+  fcntl (fds[0], F_SETFL, O_NONBLOCK);
+
+  src.fd = fds[0];
+  src.handler = event_count;
+  src.context = 0;
+  eventloop_add (el, &src);
+
+  event_calls = event_seen = 0;
+  write (fds[1], "x", 1);
+  eventloop_wait (el, 100);
+  errors += event_calls != 1 || !(event_seen & EVENT_READ);
+
+  /* Not read yet, but no new edge */
+  eventloop_wait (el, 0);
+  errors += event_calls != 1;
+
+  /* Only the earliest deadline counts */
+  gettimeofday (&start, 0);
+  when = start;
+  when.tv_usec += 30000;
+  if (when.tv_usec >= 1000000)
+    {
+      when.tv_sec++;
+      when.tv_usec -= 1000000;
+    }
+  eventloop_deadline (el, &when);
+  when.tv_sec += 10;
+  eventloop_deadline (el, &when);
+  expired = eventloop_wait (el, -1);
+  deadline_ms = event_ms_since (&start);
+  errors += !expired || deadline_ms < 25 || deadline_ms > 500;
+
+  gettimeofday (&start, 0);
+  expired = eventloop_wait (el, 20);
+  waited = event_ms_since (&start);
+  errors += !expired || waited < 15;
+
+  eventloop_remove (el, &src);
+  write (fds[1], "y", 1);
+  eventloop_wait (el, 20);
+  errors += event_calls != 1;
+
+  close (fds[0]);
+  close (fds[1]);
+
+  printf ("eventloop: deadline after %ld ms, timeout after %ld ms, "
+	  "%d errors\n", deadline_ms, waited, errors);
+}
+
+
+/* The DSP thread and the IORing under it.  A ring is filled by one
+ * thread and drained by another in odd sizes, so the data keeps
+ * wrapping around, and must come out in order.  Then a DSP thread is
+ * started: it must tick every DSP_TICK ms, run calls sent to it and
+ * send calls back, and give early ticks when asked to hurry.
+ */
+
+#define RING_TEST_BYTES (1 << 20)
+
+static struct IORing *ring_test;
+
+static void *
+ring_filler (void *arg)
+{
+  ifax_uint8 msg[64];
+  ifax_uint32 n = 0;
+  int size, t;
+
+  while (n < RING_TEST_BYTES)
+    {
+      size = 1 + n % 37;
+      for (t = 0; t < size; t++)
+	msg[t] = (n + t) & 0xff;
+      while (ioring_fill (ring_test, msg, size) != size)
+	sched_yield ();
+      n += size;
+    }
+
+  return 0;
+}
+
+static struct DSPThread *dsp_test;
+static pthread_t dsp_control;
+static volatile int dsp_ticks, dsp_early, dsp_hurries, dsp_foreign, dsp_pongs;
+
+static void
+dsp_test_tick (void *arg)
+{
+  dsp_ticks++;
+  if (dsp_test == 0)
+    return;
+  if (dsp_test->early)
+    dsp_early++;
+  if (dsp_hurries > 0)
+    {
+      dsp_hurries--;
+      dsp_test->hurry = 1;
+    }
+}
+
+static void
+dsp_test_pong (void *arg)
+{
+  dsp_pongs++;
+}
+
+static void
+dsp_test_ping (void *arg)
+{
+  dsp_foreign = !pthread_equal (pthread_self (), dsp_control);
+  dsp_reply (dsp_test, dsp_test_pong, 0);
+}
+
+static void
+dsp_test_hurry (void *arg)
+{
+  dsp_hurries = 100;
+}
+
+void
+test_dsp_thread (void)
+{
+  ifax_uint8 buf[64];
+  ifax_uint32 n = 0;
+  struct EventLoop *el;
+  pthread_t filler;
+  int size, t, bad = 0, ticks, early;
+
+  ring_test = ioring_allocate (256, "test");
+  pthread_create (&filler, 0, ring_filler, 0);
+
+  while (n < RING_TEST_BYTES)
+    {
+      if ((size = ioring_drain (ring_test, buf, 1 + n % 53)) == 0)
+	sched_yield ();
+      for (t = 0; t < size; t++)
+	bad += buf[t] != ((n + t) & 0xff);
+      n += size;
+    }
+  pthread_join (filler, 0);
+
+  printf ("ioring: %d bytes across threads, %d wrong\n", (int) n, bad);
+
+  el = eventloop_create ();
+  dsp_control = pthread_self ();
+  dsp_test = dsp_start (el, dsp_test_tick, 0, 0);
+
+  dsp_call (dsp_test, dsp_test_ping, 0);
+  for (t = 0; t < 20 && dsp_pongs == 0; t++)
+    eventloop_wait (el, 100);
+
+  ticks = dsp_ticks;
+  usleep (320 * 1000);
+  ticks = dsp_ticks - ticks;
+
+  early = dsp_early;
+  dsp_call (dsp_test, dsp_test_hurry, 0);
+  usleep (200 * 1000);
+  early = dsp_early - early;
+
+  printf ("dsp: call %s%s, %d ticks in 320 ms, %d early ticks\n",
+	  dsp_pongs == 1 ? "answered" : "NOT ANSWERED",
+	  dsp_foreign ? "" : " IN CONTROL THREAD", ticks, early);
+}
+
+
+/* A mirrored IOBuffer: after the buffer has been half used, a write
+ * straight into the one free segment runs past the end of the buffer.
+ * The bytes past the end must show up at the start, and be drained as
+ * one segment, in the same order as from an ordinary buffer.
+ */
+
+void
+test_iobuffer_mirror (void)
+{
+  struct IOBuffer *iob[2];
+  ifax_uint8 in[4096], out[2][4096], *seg, *src1, *src2;
+  int len, len1, len2, b, t, total, errors = 0;
+
+  for (t = 0; t < 4096; t++)
+    in[t] = t * 7 + (t >> 8);
+
+  iob[0] = iobuffer_allocate (4096, "plain");
+  iob[1] = iobuffer_allocate_mirrored (4096, "mirrored");
+  if (!iob[1]->mirrored)
+    printf ("iobuffer: could not mirror, testing an ordinary buffer\n");
+  total = iob[1]->total;
+
+  for (b = 0; b < 2; b++)
+    {
+      iobuffer_fill (iob[b], in, total - 1000);
+      iobuffer_drain (iob[b], out[b], total - 1000);
+      iobuffer_drain_update (iob[b], total - 1000);
+    }
+
+  /* 2000 bytes from 1000 bytes before the end */
+  iobuffer_fill_segment (iob[1], &seg, &len);
+  if (iob[1]->mirrored)
+    {
+      errors += len != total;
+      memcpy (seg, in, 2000);
+      iobuffer_fill_update (iob[1], 2000, 0);
+      errors += memcmp (&iob[1]->data[0], &in[1000], 1000) != 0;
+
+      iobuffer_drain_segments (iob[1], &src1, &len1, &src2, &len2);
+      errors += len1 != 2000 || len2 != 0 || memcmp (src1, in, 2000);
+    }
+  else
+    iobuffer_fill (iob[1], in, 2000);
+
+  iobuffer_fill (iob[0], in, 2000);
+
+  for (b = 0; b < 2; b++)
+    {
+      errors += iobuffer_drain (iob[b], out[b], 4096) != 2000;
+      iobuffer_drain_update (iob[b], 2000);
+    }
+  errors += memcmp (out[0], in, 2000) || memcmp (out[1], in, 2000);
+  errors += iob[0]->size != 0 || iob[1]->size != 0;
+
+  printf ("iobuffer: wrap past the end, %d errors\n", errors);
+}
+
+
+/* Vectored and batched IOBuffer I/O.  Data read into a buffer where it
+ * wraps around, and written out again, takes one system call each.
+ * With batching, small fills are written in fewer, larger writes, and
+ * nothing is lost or reordered.
+ */
+
+void
+test_iobuffer_io (void)
+{
+  struct IOBuffer *iob;
+  ifax_uint8 in[4000], out[4000], scratch[4096];
+  unsigned long reads, writes;
+  int from[2], to[2], t, got, errors = 0;
+
+  for (t = 0; t < 4000; t++)
+    in[t] = t * 13 + (t >> 7);
+
+  pipe (from);
+  pipe (to);
+  fcntl (from[0], F_SETFL, O_NONBLOCK);
+  fcntl (to[0], F_SETFL, O_NONBLOCK);
+
+  iob = iobuffer_allocate (4096, "io");
+  iobuffer_fill (iob, scratch, 3096);
+  iobuffer_drain_update (iob, 3096);
+
+  write (from[1], in, 2000);
+  reads = iob->stats.reads;
+  errors += iobuffer_read (iob, from[0]) != 2000;
+  errors += iob->stats.reads - reads != 1;
+  errors += memcmp (&iob->data[3096], in, 1000);
+  errors += memcmp (&iob->data[0], &in[1000], 1000);
+
+  writes = iob->stats.writes;
+  errors += iobuffer_write (iob, to[1]) != 2000;
+  errors += iob->stats.writes - writes != 1;
+  errors += read (to[0], out, sizeof (out)) != 2000;
+  errors += memcmp (out, in, 2000);
+
+  /* 40 fills of 100 bytes each */
+  iobuffer_batch (iob, 4);
+  writes = iob->stats.writes;
+  for (t = 0; t < 40; t++)
+    {
+      iobuffer_fill (iob, &in[t * 100], 100);
+      iobuffer_write_batched (iob, to[1]);
+    }
+  iobuffer_write (iob, to[1]);
+  writes = iob->stats.writes - writes;
+  got = read (to[0], out, sizeof (out));
+  errors += got != 4000 || memcmp (out, in, 4000) || writes > 20;
+
+  close (from[0]);
+  close (from[1]);
+  close (to[0]);
+  close (to[1]);
+
+  printf ("iobuffer: %lu writes for 40 batched fills, %d errors\n",
+	  writes, errors);
+}
+
+
+/* The A-law transmit conversion with DLE stuffing, against the scalar
+ * code it replaced: one table lookup and DLE check per sample.  The
+ * word-wide 'count_dle' and 'stuff_dle' are checked at every length
+ * and alignment up to a few words, and the whole encoder through the
+ * 'write' method of an ISDN line.
+ */
+
+static int
+scalar_encode (ifax_sint16 *src, ifax_uint8 *dst, int cnt)
+{
+  ifax_uint8 wala, *start = dst;
+
+  while (cnt-- > 0)
+    {
+      wala = sint2wala[((ifax_uint16) * src) >> 4];
+      *src++ = 8 * wala2sint[wala];
+      if (wala == ISDNTTY_DLE)
+	*dst++ = wala;
+      *dst++ = wala;
+    }
+
+  return dst - start;
+}
+
+static void
+alaw_test_samples (ifax_sint16 *s, int cnt)
+{
+  int t, dle;
+
+  /* A linear value that is sent as a DLE */
+  for (dle = 0; sint2wala[((ifax_uint16) dle) >> 4] != ISDNTTY_DLE; dle += 16)
+    ;
+
+  for (t = 0; t < cnt; t++)
+    s[t] = rand () % 8 == 0 ? dle : (rand () & 0xffff) - 0x8000;
+}
+
+void
+test_alaw_dle (void)
+{
+  ifax_sint16 s1[1000], s2[1000];
+  ifax_uint8 b1[2000], b2[2000], *src1, *src2;
+  struct HardwareHandle *hh;
+  struct IsdnHandle *ih;
+  int len, off, t, n1, n2, dles, len1, len2, errors = 0;
+
+  srand (11);
+
+  for (len = 0; len <= 67; len++)
+    for (off = 0; off < 4; off++)
+      {
+	for (t = 0; t < 2 * len + 8; t++)
+	  b1[t] = rand () % 5 == 0 ? ISDNTTY_DLE : rand () & 0xff;
+	memcpy (b2, b1, sizeof (b1));
+
+	for (dles = t = 0; t < len; t++)
+	  dles += b1[off + t] == ISDNTTY_DLE;
+	errors += count_dle (&b1[off], len) != dles;
+
+	stuff_dle (&b1[off], len, dles);
+	for (n2 = t = 0; t < len; t++)
+	  {
+	    errors += b1[off + n2++] != b2[off + t];
+	    if (b2[off + t] == ISDNTTY_DLE)
+	      errors += b1[off + n2++] != ISDNTTY_DLE;
+	  }
+	errors += memcmp (b1, b2, off) != 0;
+
+	alaw_test_samples (s1, len);
+	memcpy (s2, s1, len * sizeof (ifax_sint16));
+	n1 = isdn_encode_samples (s1, &b1[off], len);
+	n2 = scalar_encode (s2, b2, len);
+	errors += n1 != n2 || memcmp (&b1[off], b2, n2);
+	errors += memcmp (s1, s2, len * sizeof (ifax_sint16)) != 0;
+      }
+
+  /* Through the outgoing buffer of an ISDN line, more than once around */
+  hh = hardware_allocate ("isdn");
+  ih = hh->private;
+  for (t = 0; t < 20; t++)
+    {
+      alaw_test_samples (s1, 1000);
+      memcpy (s2, s1, sizeof (s1));
+      hh->write (hh, s1, 1000);
+      n2 = scalar_encode (s2, b2, 1000);
+
+      iobuffer_drain_segments (ih->outgoing_buffer, &src1, &len1,
+			       &src2, &len2);
+      errors += len1 + len2 != n2 || memcmp (src1, b2, len1)
+	|| memcmp (src2, &b2[len1], len2);
+      errors += memcmp (s1, s2, sizeof (s1)) != 0;
+      iobuffer_drain_update (ih->outgoing_buffer, len1 + len2);
+    }
+
+  printf ("alaw/dle: %d errors\n", errors);
+}
+
+
+/* The ISDN receive path.  'find_dle' is checked against a plain search
+ * at every length and alignment up to a few words.  Then a stream with
+ * doubled DLEs is read through the 'read' method of an ISDN line in odd
+ * sizes, and must give the same samples as decoding it byte by byte.
+ * A DLE at the very end waits for its second byte, and the DLE ETX at
+ * the end of the stream asks for the line to be hung up.
+ */
+
+void
+test_isdn_receive (void)
+{
+  ifax_uint8 buf[256], stream[3000];
+  ifax_sint16 ref[3000], got[3000];
+  struct HardwareHandle *hh;
+  struct IsdnHandle *ih;
+  int len, off, t, n, want, size, errors = 0;
+
+  srand (14);
+
+  for (len = 0; len <= 67; len++)
+    for (off = 0; off < 4; off++)
+      for (t = 0; t < 8; t++)
+	{
+	  for (n = 0; n < len + 8; n++)
+	    buf[n] = rand () & 0xff;
+	  for (n = 0; n < len + 8; n++)
+	    if (buf[n] == ISDNTTY_DLE)
+	      buf[n]++;
+	  if (t < 7 && len > 0)
+	    buf[off + rand () % len] = ISDNTTY_DLE;
+	  for (want = 0; want < len && buf[off + want] != ISDNTTY_DLE; want++)
+	    ;
+	  errors += find_dle (&buf[off], len) != want;
+	}
+
+  /* Samples and DLE DLE pairs, ended by a DLE ETX */
+  for (n = want = 0; want < 2000; want++)
+    {
+      if (rand () % 6 == 0)
+	{
+	  stream[n++] = ISDNTTY_DLE;
+	  stream[n++] = ISDNTTY_DLE;
+	  ref[want] = 8 * wala2sint[ISDNTTY_DLE];
+	}
+      else
+	{
+	  stream[n] = rand () & 0xff;
+	  if (stream[n] == ISDNTTY_DLE)
+	    stream[n]++;
+	  ref[want] = 8 * wala2sint[stream[n++]];
+	}
+    }
+  stream[n++] = ISDNTTY_DLE;
+  stream[n++] = ISDNTTY_ETX;
+
+  hh = hardware_allocate ("isdn");
+  ih = hh->private;
+
+  /* Fed in pieces that sometimes end between a DLE and its code */
+  len = 0;
+  for (off = 0, t = 0; off < n; off += size, t++)
+    {
+      size = 1 + rand () % 300;
+      if (off + size > n)
+	size = n - off;
+      iobuffer_fill (ih->incomming_buffer, &stream[off], size);
+      len += hh->read (hh, &got[len], 1 + rand () % 400);
+      while (ih->incomming_buffer->size > 1)
+	len += hh->read (hh, &got[len], 1 + rand () % 400);
+    }
+
+  errors += len != 2000 || memcmp (got, ref, sizeof (ifax_sint16) * 2000);
+  errors += ih->incomming_buffer->size != 0 || !ih->request_hangup;
+
+  printf ("isdn receive: %d samples, hangup %s, %d errors\n", len,
+	  ih->request_hangup ? "requested" : "MISSING", errors);
+}
+
+
+/* The ISDN message automaton against a plain search.  The input is made
+ * of the message strings and bits of them, so there are lots of near
+ * misses.  'matcher_scan' must find where the first message starts, or
+ * where the input ends in the start of one; 'matcher_anchored' must see
+ * a message at the very start, and whether a longer one may follow.
+ */
+
+static char *isdn_messages[] = {
+  "\r\nOK\r\n", "\r\nERROR\r\n", "\r\nVCON\r\n", "\r\nBUSY\r\n",
+  "\r\nNO CARRIER\r\n", "\r\nRING\r\n", "\r\nCALLER NUMBER: ", "\r\n", 0
+};
+
+static int
+scalar_scan (ifax_uint8 *buf, int len)
+{
+  int i, m, k;
+
+  for (i = 0; i < len; i++)
+    for (m = 0; isdn_messages[m] != 0; m++)
+      {
+	k = strlen (isdn_messages[m]);
+	if (k > len - i)
+	  k = len - i;
+	if (!memcmp (&buf[i], isdn_messages[m], k))
+	  return i;
+      }
+
+  return len;
+}
+
+void
+test_isdn_matcher (void)
+{
+  ifax_uint8 buf[64];
+  char *m;
+  int len, t, n, k, found, partial, want_found, want_partial, errors = 0;
+  long scans = 0;
+
+  hardware_allocate ("isdn");		/* Makes the automaton */
+  srand (15);
+
+  for (t = 0; t < 200000; t++)
+    {
+      len = rand () % 40;
+      for (n = 0; n < len; n += k)
+	{
+	  m = isdn_messages[rand () % 8];
+	  k = strlen (m);
+	  if (rand () % 3)
+	    k = rand () % k + 1;	/* Only the start of it */
+	  if (rand () % 4 == 0)
+	    {
+	      k = 1;			/* Something else */
+	      m = "xOK\n\r ";
+	      m += rand () % 6;
+	    }
+	  if (k > len - n)
+	    k = len - n;
+	  memcpy (&buf[n], m, k);
+	}
+
+      errors += matcher_scan (buf, len) != scalar_scan (buf, len);
+      scans++;
+
+      found = matcher_anchored (buf, len, &partial) != 0;
+      want_found = want_partial = 0;
+      for (n = 0; isdn_messages[n] != 0; n++)
+	{
+	  k = strlen (isdn_messages[n]);
+	  if (k <= len && !memcmp (buf, isdn_messages[n], k))
+	    want_found = 1;
+	  if (k > len && !memcmp (buf, isdn_messages[n], len))
+	    want_partial = 1;
+	}
+      errors += found != want_found || (partial != 0) != want_partial;
+    }
+
+  printf ("isdn matcher: %ld inputs, %d errors\n", scans, errors);
+}
+
+
+/* A hardware driver that is always online, and has 'lead_avail' samples
+ * for the linedriver to read each time it is serviced, like a line on
+ * the clock of the network.  What is written is only counted.
+ */
+
+#define LEAD_MARGIN 64		/* As in the linedriver */
+
+static int lead_avail;
+static long lead_read, lead_written;
+
+static int
+lead_hw_read (struct HardwareHandle *hh, ifax_sint16 *smpls, int cnt)
+{
+  if (cnt > lead_avail)
+    cnt = lead_avail;
+  memset (smpls, 0, cnt * sizeof (ifax_sint16));
+  lead_avail -= cnt;
+  lead_read += cnt;
+  return cnt;
+}
+
+static void
+lead_hw_write (struct HardwareHandle *hh, ifax_sint16 *smpls, int cnt)
+{
+  lead_written += cnt;
+}
+
+static int
+lead_round (ifax_modp line, int samples, linedriver_stats *st)
+{
+  lead_avail = samples;
+  ifax_command (line, CMD_LINEDRIVER_WORK);
+  ifax_command (line, CMD_LINEDRIVER_STATS, st);
+  return st->lead;
+}
+
+/* The peak read decays between rounds, so the target for rounds of 160
+ * samples is one below 160 plus the margin every other round.  The lead
+ * is only cut back when more than the margin above the target.
+ */
+
+static int
+lead_steady (linedriver_stats *st)
+{
+  return st->target >= 160 + LEAD_MARGIN - 1 && st->target <= 160 + LEAD_MARGIN
+    && st->lead >= st->target && st->lead <= st->target + LEAD_MARGIN;
+}
+
+/* Service the linedriver in rounds of 160 samples, with a late round
+ * now and then.  The playout lead should settle on its target, a late
+ * round beyond the lead should be counted as an underrun and raise the
+ * target, and the target should decay again afterwards.  With no source
+ * every sample written is silence.
+ */
+
+void
+test_playout_lead (void)
+{
+  struct HardwareHandle hh;
+  linedriver_stats st;
+  ifax_modp line;
+  int t, errors = 0, high;
+
+  memset (&hh, 0, sizeof (hh));
+  hh.state = ONLINE;
+  hh.read = lead_hw_read;
+  hh.write = lead_hw_write;
+  line = ifax_create_module (IFAX_LINEDRIVER);
+  ifax_command (line, CMD_LINEDRIVER_HARDWARE, &hh);
+
+  for (t = 0; t < 50; t++)
+    lead_round (line, 160, &st);
+  if (st.underruns != 0 || !lead_steady (&st))
+    errors++;
+
+  /* Late, but not beyond the lead */
+  lead_round (line, 300, &st);
+  if (st.underruns != 0)
+    errors++;
+
+  /* Late beyond the lead */
+  lead_round (line, 600, &st);
+  if (st.underruns != 1 || st.target != 600 + LEAD_MARGIN)
+    errors++;
+  high = st.target;
+
+  for (t = 0; t < 100; t++)
+    if (lead_round (line, 160, &st) < st.target)
+      errors++;
+  if (st.underruns != 1 || st.target >= high)
+    errors++;
+
+  for (t = 0; t < 3000; t++)
+    lead_round (line, 160, &st);
+  if (st.underruns != 1 || !lead_steady (&st))
+    errors++;
+  if (st.silence != lead_written || st.overruns != 0)
+    errors++;
+
+  /* Offline, the counts of the call are kept until the next one */
+  hh.state = IDLE;
+  lead_round (line, 0, &st);
+  if (st.underruns != 1)
+    errors++;
+  hh.state = ONLINE;
+  lead_round (line, 160, &st);
+  if (st.underruns != 0 || st.silence != 160 + st.target)
+    errors++;
+
+  printf ("playout lead: %ld read, %ld written, lead %d of %d, %d errors\n",
+	  lead_read, lead_written, st.lead, st.target, errors);
+  ifax_destroy_module (line);
+}
+
+
+/* Stereo frames for the recorder: the round in the left channel and the
+ * frame within it in the right.
+ */
+
+static void
+recorder_frames (ifax_sint16 *frames, int round, int n)
+{
+  int t;
+
+  for (t = 0; t < n; t++)
+    {
+      frames[2 * t] = round;
+      frames[2 * t + 1] = -t;
+    }
+}
+
+static unsigned long
+recorder_get32 (ifax_uint8 *p)
+{
+  return p[0] | p[1] << 8 | (unsigned long) p[2] << 16
+    | (unsigned long) p[3] << 24;
+}
+
+/* Read back a recording of rounds of 'n' frames made by
+ * 'recorder_frames'.  Returns the number of frames in the file, or -1 if
+ * the header is wrong or the rounds are damaged or out of order.
+ */
+
+static long
+recorder_check (char *name, int n)
+{
+  ifax_uint8 header[44];
+  ifax_sint16 frame[2];
+  long frames = 0;
+  int last = -1;
+  FILE *fp;
+
+  if ((fp = fopen (name, "r")) == 0)
+    return -1;
+  if (fread (header, 1, 44, fp) != 44 || memcmp (header, "RIFF", 4)
+      || memcmp (header + 8, "WAVEfmt ", 8) || memcmp (header + 36, "data", 4)
+      || header[22] != 2 || recorder_get32 (header + 24) != 8000)
+    frames = -1;
+
+  while (frames >= 0 && fread (frame, sizeof (frame), 1, fp) == 1)
+    {
+      if (frame[1] == 0 && frame[0] > last)
+	last = frame[0];
+      else if (frame[0] != last || frame[1] != -(frames % n))
+	frames = -1;
+      if (frames >= 0)
+	frames++;
+    }
+
+  if (frames >= 0 && (frames % n != 0 || recorder_get32 (header + 40)
+		      != frames * 4 || recorder_get32 (header + 4)
+		      != frames * 4 + 36))
+    frames = -1;
+  fclose (fp);
+  return frames;
+}
+
+/* Record in rounds of 160 stereo frames, first at the pace of a line
+ * and then much faster than the recorder thread can keep up with, and
+ * read the WAV file back.  Every round should be in it or counted as
+ * dropped.  Finally a recorder writing to a pipe no one reads should
+ * give up without taking the program down with SIGPIPE.
+ */
+
+void
+test_recorder (void)
+{
+  char name[] = "/tmp/recorderXXXXXX";
+  ifax_sint16 frames[2 * 160];
+  struct Recorder *rec;
+  unsigned long dropped;
+  int fd, round, errors = 0, rejected = 0, pipefd[2];
+  long frames_in_file;
+
+  if ((fd = mkstemp (name)) < 0)
+    return;
+  close (fd);
+
+  rec = recorder_start (name, 2, 8000);
+  for (round = 0; round < 100; round++)
+    {
+      recorder_frames (frames, round, 160);
+      if (recorder_write (rec, frames, 160))
+	errors++;
+      if (round % 10 == 9)
+	usleep (20000);
+    }
+  recorder_stop (rec);
+  if (recorder_check (name, 160) != 100 * 160)
+    errors++;
+
+  rec = recorder_start (name, 2, 8000);
+  for (round = 0; round < 1000; round++)
+    {
+      recorder_frames (frames, round, 160);
+      rejected += recorder_write (rec, frames, 160);
+    }
+  dropped = rec->dropped;
+  recorder_stop (rec);
+  frames_in_file = recorder_check (name, 160);
+  if (rejected == 0 || dropped != rejected * 160
+      || frames_in_file != (1000 - rejected) * 160)
+    errors++;
+  unlink (name);
+
+  if (pipe (pipefd) == 0)
+    {
+      close (pipefd[0]);
+      rec = recorder_attach (pipefd[1], "pipe", 2, 8000);
+      recorder_frames (frames, 0, 160);
+      recorder_write (rec, frames, 160);
+      while (!rec->failed)
+	usleep (10000);
+      if (recorder_write (rec, frames, 160))
+	errors++;
+      recorder_stop (rec);
+    }
+
+  printf ("recorder: %d of 1000 rounds dropped, %d errors\n", rejected,
+	  errors);
+}
+
+
+/* Feed a monitor 'rounds' rounds of 160 pairs, the round number in the
+ * transmit direction and its negative in the receive direction.  Returns
+ * the longest time a round took, in milliseconds.
+ */
+
+static double
+monitor_rounds (ifax_modp monitor, int first, int rounds)
+{
+  ifax_sint16 pairs[2 * 160];
+  struct timeval start, end;
+  double ms, longest = 0;
+  int round, t;
+
+  for (round = first; round < first + rounds; round++)
+    {
+      for (t = 0; t < 160; t++)
+	{
+	  pairs[2 * t] = round;
+	  pairs[2 * t + 1] = -round;
+	}
+      gettimeofday (&start, 0);
+      ifax_handle_input (monitor, pairs, 160);
+      gettimeofday (&end, 0);
+      ms = (end.tv_sec - start.tv_sec) * 1e3
+	+ (end.tv_usec - start.tv_usec) / 1e3;
+      if (ms > longest)
+	longest = ms;
+    }
+
+  return longest;
+}
+
+/* A monitor to a raw file, decimating by 4 and mixing down, should write
+ * the averaged and scaled sum of the two directions.  A monitor to a
+ * UNIX socket whose listener doesn't read should never hold up the
+ * caller; the samples that don't fit are dropped and counted, and those
+ * that get through are whole rounds in order.
+ */
+
+void
+test_monitor (void)
+{
+  char name[] = "/tmp/monitorXXXXXX", target[64];
+  ifax_sint16 raw[2 * 160];
+  struct sockaddr_un addr;
+  ifax_modp monitor;
+  unsigned long sent, dropped;
+  double longest;
+  ifax_sint16 *heard;
+  int fd, listener, peer, n, t, round, last = 0, errors = 0;
+  long frames = 0, got;
+  FILE *fp;
+
+  if ((fd = mkstemp (name)) < 0)
+    return;
+  close (fd);
+
+  /* Transmitted only, and then half of it less a quarter of received */
+  monitor = ifax_create_module (IFAX_MONITOR, name, 4, 1);
+  ifax_command (monitor, CMD_MONITOR_VOLUME, 0x10000, 0);
+  monitor_rounds (monitor, 400, 10);
+  ifax_command (monitor, CMD_MONITOR_VOLUME, 0x8000, 0x4000);
+  monitor_rounds (monitor, 1000, 10);
+  ifax_destroy_module (monitor);
+
+  if ((fp = fopen (name, "r")) == 0)
+    errors++;
+  else
+    {
+      while ((n = fread (raw, sizeof (ifax_sint16), 40, fp)) == 40)
+	{
+	  round = frames < 400 ? 400 + frames / 40 : 990 + frames / 40;
+	  for (t = 0; t < 40; t++)
+	    if (raw[t] != (frames < 400 ? round
+			   : round / 2 - (round + 3) / 4))
+	      errors++;
+	  frames += 40;
+	}
+      if (n != 0 || frames != 800)
+	errors++;
+      fclose (fp);
+    }
+  unlink (name);
+
+  /* A listener that doesn't read */
+  listener = socket (AF_UNIX, SOCK_STREAM, 0);
+  memset (&addr, 0, sizeof (addr));
+  addr.sun_family = AF_UNIX;
+  strcpy (addr.sun_path, name);
+  if (bind (listener, (struct sockaddr *) &addr, sizeof (addr)) < 0
+      || listen (listener, 1) < 0)
+    {
+      printf ("monitor: no socket\n");
+      return;
+    }
+  sprintf (target, "unix:%s", name);
+  monitor = ifax_create_module (IFAX_MONITOR, target, 1, 0);
+  heard = malloc (2000 * 160 * 4);
+  peer = accept (listener, 0, 0);
+
+  longest = monitor_rounds (monitor, 0, 2000);
+
+  /* Read until the recorder thread has nothing more to write */
+  fcntl (peer, F_SETFL, O_NONBLOCK);
+  got = 0;
+  do
+    {
+      usleep (200000);
+      for (n = 0; (t = read (peer, (char *) heard + got,
+			     2000 * 160 * 4 - got)) > 0; n += t)
+	got += t;
+    }
+  while (n > 0);
+  ifax_command (monitor, CMD_MONITOR_STATS, &sent, &dropped);
+  if (dropped == 0 || sent == 0 || sent + dropped != 2000 * 160
+      || got != sent * 4 || longest > 500)
+    errors++;
+
+  /* What got through is whole rounds, in order */
+  for (frames = 0; frames < got / 4; frames++)
+    {
+      round = heard[2 * frames];
+      if (heard[2 * frames + 1] != -round || round < last
+	  || (round > last && frames % 160 != 0))
+	errors++;
+      last = round;
+    }
+  free (heard);
+
+  close (peer);
+  ifax_destroy_module (monitor);
+  close (listener);
+  unlink (name);
+
+  printf ("monitor: %lu frames sent, %lu dropped, longest round %.2f ms, "
+	  "%d errors\n", sent, dropped, longest, errors);
+}
+
+
+/* Run the same signals through N single-channel modules and through one
+ * bank module doing N channels, and check that the outputs are the same
+ * to the bit: V.21 modulation, rate conversion to 8 kHz and FSK
+ * demodulation.  Each stage is fed the output of the single modules of
+ * the stage before.  The last channel of each bank is also sent to a
+ * destination of its own with CMD_BANK_SENDTO.
+ */
+
+#define BANK_CHANNELS 5
+#define BANK_BITS 400
+#define BANK_SAMPLES (BANK_BITS * 24 * 10 / 9 + 100)
+
+struct bank_capture
+{
+  ifax_uint8 *data;
+  size_t unit, n, max;
+};
+
+static int bank_sink_handle (ifax_modp self, void *data, size_t length)
+{
+  struct bank_capture *out = self->private;
+
+  if (length > out->max - out->n)
+    length = out->max - out->n;
+  memcpy (out->data + out->n * out->unit, data, length * out->unit);
+  out->n += length;
+
+  return length;
+}
+
+static int bank_sink_construct (ifax_modp self, va_list args)
+{
+  self->private = va_arg (args, void *);
+  self->handle_input = bank_sink_handle;
+  self->command = curve_command;
+  self->destroy = curve_destroy;
+  return 0;
+}
+
+static ifax_module_id bank_sink_id;
+
+static ifax_modp
+bank_sink (struct bank_capture *out, size_t unit, size_t max)
+{
+  out->unit = unit;
+  out->max = max;
+  out->n = 0;
+  out->data = malloc (unit * max);
+  return ifax_create_module (bank_sink_id, out);
+}
+
+/* Feed 'single[c]' the 'n' units of 'in[c]', and 'bank' the same
+ * interleaved, 'step' units at a time.  There are 'per' units in each
+ * element of 'in' (8 bits in a byte for the modulator).  Returns the
+ * number of units where the bank output differs, or -1 if the lengths
+ * differ.
+ */
+
+static int
+bank_compare (ifax_modp *single, ifax_modp bank, struct bank_capture *in,
+	      size_t n, size_t step, size_t per, size_t outunit,
+	      struct bank_capture *out)
+{
+  struct bank_capture bankout, routed;
+  size_t inunit = in[0].unit;
+  ifax_uint8 *frames;
+  size_t t, k, chunk, elements;
+  int c, diff = 0;
+
+  for (c = 0; c < BANK_CHANNELS; c++)
+    ifax_connect (single[c], bank_sink (&out[c], outunit, BANK_SAMPLES));
+  ifax_connect (bank, bank_sink (&bankout, BANK_CHANNELS * outunit,
+				 BANK_SAMPLES));
+  ifax_command (bank, CMD_BANK_SENDTO, BANK_CHANNELS - 1,
+		bank_sink (&routed, outunit, BANK_SAMPLES));
+
+  frames = malloc (BANK_CHANNELS * inunit * step);
+  for (t = 0; t < n; t += chunk)
+    {
+      chunk = n - t < step ? n - t : step;
+      elements = (chunk + per - 1) / per;
+      for (c = 0; c < BANK_CHANNELS; c++)
+	{
+	  ifax_handle_input (single[c], in[c].data + t / per * inunit, chunk);
+	  for (k = 0; k < elements; k++)
+	    memcpy (frames + (k * BANK_CHANNELS + c) * inunit,
+		    in[c].data + (t / per + k) * inunit, inunit);
+	}
+      ifax_handle_input (bank, frames, chunk);
+    }
+  free (frames);
+
+  for (c = 0; c < BANK_CHANNELS; c++)
+    {
+      if (out[c].n != bankout.n || out[c].n == 0)
+	return -1;
+      for (t = 0; t < out[c].n; t++)
+	if (memcmp (out[c].data + t * outunit,
+		    bankout.data + (t * BANK_CHANNELS + c) * outunit,
+		    outunit))
+	  diff++;
+    }
+  if (routed.n != out[BANK_CHANNELS - 1].n
+      || memcmp (routed.data, out[BANK_CHANNELS - 1].data,
+		 routed.n * outunit))
+    diff++;
+
+  free (bankout.data);
+  free (routed.data);
+  return diff;
+}
+
+void
+test_bank (void)
+{
+  struct bank_capture bits[BANK_CHANNELS], v21[BANK_CHANNELS];
+  struct bank_capture rate[BANK_CHANNELS], fsk[BANK_CHANNELS];
+  ifax_modp single[BANK_CHANNELS], bank;
+  int c, t, diff[3];
+
+  bank_sink_id = ifax_register_module_class ("Bank sink",
+					     bank_sink_construct);
+  srand (1999);
+  for (c = 0; c < BANK_CHANNELS; c++)
+    {
+      bits[c].unit = 1;
+      bits[c].n = BANK_BITS / 8;
+      bits[c].data = malloc (BANK_BITS / 8);
+      for (t = 0; t < BANK_BITS / 8; t++)
+	bits[c].data[t] = rand ();
+    }
+
+  for (c = 0; c < BANK_CHANNELS; c++)
+    single[c] = ifax_create_module (IFAX_MODULATORV21, 2);
+  bank = ifax_create_module (IFAX_MODULATORV21_BANK, BANK_CHANNELS, 2);
+  diff[0] = bank_compare (single, bank, bits, BANK_BITS, 56, 8,
+			  sizeof (ifax_sint16), v21);
+
+  for (c = 0; c < BANK_CHANNELS; c++)
+    single[c] = ifax_create_module (IFAX_RATECONVERT, 10, 9, 250,
+				    rate_7k2_8k_1, 0x10000);
+  bank = ifax_create_module (IFAX_RATECONVERT_BANK, BANK_CHANNELS, 10, 9,
+			     250, rate_7k2_8k_1, 0x10000);
+  diff[1] = bank_compare (single, bank, v21, v21[0].n, 160, 1,
+			  sizeof (ifax_sint16), rate);
+
+  for (c = 0; c < BANK_CHANNELS; c++)
+    single[c] = ifax_create_module (IFAX_FSKDEMOD, 8000, 1650, 1850, 300);
+  bank = ifax_create_module (IFAX_FSKDEMOD_BANK, BANK_CHANNELS, 8000, 1650,
+			     1850, 300);
+  diff[2] = bank_compare (single, bank, rate, rate[0].n, 100, 1, 2, fsk);
+
+  if (ifax_create_module (IFAX_FSKDEMOD_BANK, 0, 8000, 1650, 1850, 300) != 0
+      || ifax_create_module (IFAX_MODULATORV21_BANK, 0, 2) != 0
+      || ifax_create_module (IFAX_RATECONVERT_BANK, 0, 10, 9, 250,
+			     rate_7k2_8k_1, 0x10000) != 0)
+    diff[2]++;
+
+  printf ("bank: %d channels, %d samples at 8 kHz, differences: "
+	  "V.21 %d, rate %d, FSK %d\n", BANK_CHANNELS, (int) rate[0].n,
+	  diff[0], diff[1], diff[2]);
+}
+
+
+/* Compare the block sine functions with a loop over 'intsin' and
+ * 'intcos', for start phases and increments that wrap and for every
+ * block length around the four-sample unrolling.  The sweep is also
+ * run with a stride, checking that it leaves the samples in between
+ * alone.
+ */
+
+#define SINCOS_MAXN	13
+#define SINCOS_GUARD	0x5a5a
+
+static ifax_sint16
+sincos_scaled (unsigned int w, ifax_sint32 scale)
+{
+  return (ifax_sint16) ((ifax_uint32) (intsin (w) * scale) >> 16);
+}
+
+void
+test_sincos_blocks (void)
+{
+  static unsigned int phases[] = { 0, 1, 0x3ff0, 0xfff0, 0xffff, 0x1fff7 };
+  static unsigned int incs[] = { 0, 1, 13926, 0x8001, 0xfff0, 0xffff,
+				 0x12345 };
+  static ifax_sint32 scales[] = { 0x10000, 0x8000, 0x5a82, 0x1234 };
+  ifax_sint16 dst[3 * SINCOS_MAXN], cosdst[SINCOS_MAXN];
+  ifax_sint16 sindst[SINCOS_MAXN];
+  ifax_uint16 sweep[2 * SINCOS_MAXN];
+  unsigned int w, ref, ret;
+  int p, i, s, n, t, stride, step, runs = 0, errors = 0;
+
+  srand (4711);
+  for (t = 0; t < 2 * SINCOS_MAXN; t++)
+    sweep[t] = rand () & 0xffff;
+  sweep[1] = 0xffff;
+  sweep[2] = 0;
+
+  for (p = 0; p < sizeof (phases) / sizeof (phases[0]); p++)
+    for (n = 0; n <= SINCOS_MAXN; n++)
+      {
+	for (i = 0; i < sizeof (incs) / sizeof (incs[0]); i++)
+	  {
+	    for (s = 0; s < sizeof (scales) / sizeof (scales[0]); s++)
+	      {
+		ret = intsin_block (dst, n, phases[p], incs[i], scales[s]);
+		for (t = 0, w = phases[p]; t < n; t++, w += incs[i])
+		  if (dst[t] != sincos_scaled (w, scales[s]))
+		    errors++;
+		if (ret != (w & 0xffff))
+		  errors++;
+		runs++;
+	      }
+
+	    ret = intsincos_block (cosdst, sindst, n, phases[p], incs[i]);
+	    for (t = 0, w = phases[p]; t < n; t++, w += incs[i])
+	      if (cosdst[t] != intcos (w) || sindst[t] != intsin (w))
+		errors++;
+	    if (ret != (w & 0xffff))
+	      errors++;
+	    runs++;
+	  }
+
+	for (stride = 1; stride <= 3; stride += 2)
+	  for (step = 0; step <= 2; step++)
+	    for (s = 0; s < sizeof (scales) / sizeof (scales[0]); s++)
+	      {
+		for (t = 0; t < 3 * SINCOS_MAXN; t++)
+		  dst[t] = SINCOS_GUARD;
+		ret = intsin_sweep (dst, stride, n, phases[p], sweep, step,
+				    scales[s]);
+		w = phases[p];
+		for (t = 0; t < 3 * SINCOS_MAXN; t++)
+		  {
+		    if (t % stride == 0 && t / stride < n)
+		      {
+			if (dst[t] != sincos_scaled (w, scales[s]))
+			  errors++;
+			w += sweep[(t / stride) * step];
+		      }
+		    else if (dst[t] != SINCOS_GUARD)
+		      errors++;
+		  }
+		if (ret != (w & 0xffff))
+		  errors++;
+		runs++;
+	      }
+      }
+
+  printf ("sincos: %d block runs, %d differences from intsin/intcos\n",
+	  runs, errors);
+}
+
+
+/* Replay a small recorded call through the file hardware driver.  The
+ * file has every byte value in it, doubled DLEs and a DLE code that is
+ * to be ignored, and either just ends or ends with DLE ETX followed by
+ * bytes that must not be replayed.  A block of samples covering every
+ * A-law value is transmitted before each read, and the output file is
+ * checked to hold them in order with the DLEs doubled.
+ */
+
+#define FILELINE_SAMPLES	300
+#define FILELINE_CHUNK		64
+
+static int
+fileline_replay (int etx, int *errors)
+{
+  char in[] = "/tmp/filelineXXXXXX", out[] = "/tmp/filelineXXXXXX";
+  ifax_sint16 rx[FILELINE_SAMPLES + FILELINE_CHUNK], tx[256];
+  ifax_uint8 enc[256];
+  struct HardwareHandle *hh;
+  FILE *fp;
+  int fd, i, c, got = 0, writes = 0, bytes = 0, dles = 0, stuffed = 0;
+
+  if ((fd = mkstemp (in)) < 0)
+    return -1;
+  fp = fdopen (fd, "w");
+  for (i = 0; i < FILELINE_SAMPLES; i++)
+    {
+      if (i == FILELINE_SAMPLES / 2)
+	fputs ("\020\024", fp);		/* DLE DC4, ignored */
+      if ((i & 0xff) == 0x10)
+	putc (0x10, fp);
+      putc (i & 0xff, fp);
+    }
+  if (etx)
+    fputs ("\020\003\001\002\003", fp);
+  fclose (fp);
+
+  if ((fd = mkstemp (out)) < 0)
+    {
+      unlink (in);
+      return -1;
+    }
+  close (fd);
+
+  for (i = 0; i < 256; i++)
+    {
+      tx[i] = 8 * wala2sint[i];
+      enc[i] = sint2wala[((ifax_uint16) tx[i]) >> 4];
+      if (enc[i] == 0x10)
+	stuffed++;
+    }
+
+  hh = hardware_allocate ("file");
+  hh->configure (hh, "input", in);
+  hh->configure (hh, "output", out);
+  hh->initialize (hh);
+  if (hh->error || hh->state != ONLINE)
+    (*errors)++;
+
+  while (hh->state == ONLINE && got <= FILELINE_SAMPLES)
+    {
+      hh->write (hh, tx, 256);
+      writes++;
+      hh->service_select (hh, 0, 0, 0);
+      got += hh->read (hh, &rx[got], FILELINE_CHUNK);
+    }
+  if (hh->state != IDLE || hh->read (hh, rx, FILELINE_CHUNK) != 0)
+    (*errors)++;
+
+  if (got != FILELINE_SAMPLES)
+    (*errors)++;
+  for (i = 0; i < got && i < FILELINE_SAMPLES; i++)
+    if (rx[i] != 8 * wala2sint[i & 0xff])
+      (*errors)++;
+
+  /* The output should be the transmitted samples, DLE doubled */
+  if ((fp = fopen (out, "r")) == 0)
+    (*errors)++;
+  else
+    {
+      while ((c = getc (fp)) != EOF)
+	{
+	  if (c == 0x10)
+	    {
+	      if (getc (fp) != 0x10)
+		(*errors)++;
+	      dles++;
+	    }
+	  if (c != enc[bytes % 256])
+	    (*errors)++;
+	  bytes++;
+	}
+      fclose (fp);
+    }
+  if (bytes != writes * 256 || stuffed == 0 || dles != writes * stuffed)
+    (*errors)++;
+
+  unlink (in);
+  unlink (out);
+  free (hh->private);
+  free (hh);
+
+  return got;
+}
+
+void
+test_fileline (void)
+{
+  int errors = 0, eof, etx;
+
+  eof = fileline_replay (0, &errors);
+  etx = fileline_replay (1, &errors);
+
+  printf ("fileline: %d of %d samples to EOF, %d to DLE ETX, "
+	  "%d errors\n", eof, FILELINE_SAMPLES, etx, errors);
+}
+
+
 void main (int argc, char **argv)
 {
 
@@ -477,6 +3570,31 @@ void main (int argc, char **argv)
   /* test_hdlc(); */
   /* test_linedriver(); */
   /* test_v29demod (); */
+  /* test_channel_curves(); */
+  /* test_atan_kernels(); */
+  /* test_crc16(); */
+  /* test_hdlc_deframer(); */
+  /* test_hdlc_encoder(); */
+  /* test_hdlc_queue(); */
+  /* test_scrambler_words(); */
+  /* test_loopback_frame(); */
+  /* test_fth_ok(); */
+  /* test_pipeline(); */
+  /* test_buffer_pool(); */
+  /* test_config_lines(); */
+  /* test_eventloop(); */
+  /* test_dsp_thread(); */
+  /* test_iobuffer_mirror(); */
+  /* test_iobuffer_io(); */
+  /* test_alaw_dle(); */
+  /* test_isdn_receive(); */
+  /* test_isdn_matcher(); */
+  /* test_playout_lead(); */
+  /* test_recorder(); */
+  /* test_monitor(); */
+  /* test_bank(); */
+  /* test_sincos_blocks(); */
+  /* test_fileline(); */
   test_new_v21_demod();
 
   exit (0);